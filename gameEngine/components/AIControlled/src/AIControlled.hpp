@@ -10,4 +10,6 @@ struct AIControlled : public Component<AIControlled>
     static constexpr const char* Name = "AIControlled";
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<AIControlled>);
+static_assert(isTagComponent<AIControlled>);
 }  // namespace GameEngine
@@ -78,4 +78,5 @@ struct Acceleration : public Component<Acceleration>
      */
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<Acceleration>);
 }  // namespace GameEngine
@@ -139,4 +139,5 @@ struct Collider : public Component<Collider>
      */
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<Collider>);
 }  // namespace GameEngine
@@ -73,4 +73,5 @@ struct Damage : public Component<Damage>
      */
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<Damage>);
 }  // namespace GameEngine
@@ -100,4 +100,5 @@ struct Domain : public Component<Domain>
      */
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<Domain>);
 }  // namespace GameEngine
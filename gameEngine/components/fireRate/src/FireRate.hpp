@@ -17,4 +17,5 @@ struct FireRate : public Component<FireRate>
     static constexpr const char* Name = "FireRate";
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<FireRate>);
 }  // namespace GameEngine
@@ -87,4 +87,5 @@ struct Gravity : public Component<Gravity>
      */
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<Gravity>);
 }  // namespace GameEngine
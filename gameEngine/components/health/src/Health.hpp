@@ -112,4 +112,5 @@ struct Health : public Component<Health>
      */
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<Health>);
 }  // namespace GameEngine
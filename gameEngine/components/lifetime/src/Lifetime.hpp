@@ -110,4 +110,5 @@ struct Lifetime : public Component<Lifetime>
      */
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<Lifetime>);
 }  // namespace GameEngine
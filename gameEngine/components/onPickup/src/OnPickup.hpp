@@ -27,4 +27,5 @@ struct OnPickup : public Component<OnPickup>
     static constexpr const char* Name = "OnPickup";
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<OnPickup>);
 }  // namespace GameEngine
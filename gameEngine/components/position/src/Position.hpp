@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "../../../ecs/Component.hpp"
 #include "../../../ecs/utils.hpp"
 
@@ -104,4 +106,46 @@ struct Position : public Component<Position>
      */
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<Position>);
+
+/**
+ * @brief Returns the Z-order (Morton) index of the `cellSize` grid cell
+ * holding `position`.
+ *
+ * Nearby positions get nearby keys, so sorting the Position pool by this key
+ * (see SpatialOrder) makes the Collision broadphase read neighbouring cells
+ * from neighbouring memory. Cell coordinates are clamped to [0, 65535].
+ */
+inline uint32_t spatialKey(const Position& position, float cellSize = 64.0f)
+{
+    auto cell = [cellSize](float value) -> uint32_t {
+        const float index = value / cellSize;
+        if (!(index > 0.0f))
+            return 0;
+        return index >= 65535.0f ? 65535u : static_cast<uint32_t>(index);
+    };
+    auto spread = [](uint32_t bits) {
+        bits = (bits | (bits << 8)) & 0x00FF00FFu;
+        bits = (bits | (bits << 4)) & 0x0F0F0F0Fu;
+        bits = (bits | (bits << 2)) & 0x33333333u;
+        bits = (bits | (bits << 1)) & 0x55555555u;
+        return bits;
+    };
+    return spread(cell(position.pos.x)) | (spread(cell(position.pos.y)) << 1);
+}
+
+/**
+ * @struct SpatialOrder
+ * @brief Orders positions by spatialKey(), for `Registry::sort()` and
+ * `Registry::sortIncrementally()`.
+ */
+struct SpatialOrder
+{
+    float cellSize = 64.0f;  ///< Side of the grid cells, in pixels.
+
+    bool operator()(const Position& lhs, const Position& rhs) const
+    {
+        return spatialKey(lhs, cellSize) < spatialKey(rhs, cellSize);
+    }
+};
 }  // namespace GameEngine
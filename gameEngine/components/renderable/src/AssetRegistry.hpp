@@ -0,0 +1,164 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../../../ecs/utils.hpp"
+
+namespace GameEngine {
+/// @brief Interned sprite sheet path (see AssetRegistry::sheet()).
+using SheetID = uint16_t;
+
+/// @brief Interned frame table (see AssetRegistry::animation()).
+using AnimationID = uint16_t;
+
+/**
+ * @struct SpriteAnimation
+ * @brief Frame table shared by every `Renderable` playing the same animation.
+ */
+struct SpriteAnimation
+{
+    std::vector<vec2> frames;  ///< Top-left corner of each frame.
+    vec2 frameSize;            ///< Width and height of every frame.
+    int frameDuration = 0;     ///< Milliseconds per frame.
+    bool autoAnimate = false;  ///< Whether the frames are meant to loop.
+};
+
+/**
+ * @class AssetRegistry
+ * @brief Per-world table of the cold render data referenced by `Renderable`.
+ *
+ * Sprite sheet paths and frame tables are interned once and handed out as
+ * small IDs, so that a `Renderable` stays a few trivially copyable bytes
+ * whatever the size of its animation. Interning the same path or the same
+ * table twice returns the same ID.
+ *
+ * Lives in the `Resources` of a `Registry`:
+ * @code
+ * auto& assets = registry.resources().getOrEmplace<AssetRegistry>();
+ * registry.emplace<Renderable>(
+ *     e, assets.sheet("assets/sprites/player.png"),
+ *     assets.animation({vec2(0, 0), vec2(32, 0)}, vec2(32, 32), 100, true));
+ * @endcode
+ *
+ * ID 0 is the empty sheet and the empty animation of a default
+ * `Renderable`. IDs are never reused, and references returned by
+ * sheetPath() and animation() stay valid until the next interning.
+ */
+class AssetRegistry
+{
+   public:
+    AssetRegistry()
+    {
+        sheet("");
+        animation({}, vec2(), 0, false);
+    }
+
+    /**
+     * @brief Interns a sprite sheet path.
+     * @return The ID of `path`, the same for every call with that path.
+     * @throws std::length_error when every ID is taken.
+     */
+    SheetID sheet(const std::string& path)
+    {
+        auto it = sheetIDs.find(path);
+        if (it != sheetIDs.end()) {
+            return it->second;
+        }
+        const SheetID id = nextID<SheetID>(sheetPaths.size());
+        sheetPaths.push_back(path);
+        sheetIDs.emplace(path, id);
+        return id;
+    }
+
+    /// @brief Returns the path interned as `id`.
+    const std::string& sheetPath(SheetID id) const
+    {
+        return sheetPaths[id];
+    }
+
+    /**
+     * @brief Interns a frame table.
+     * @param frames Top-left corner of each frame in the sheet.
+     * @param frameSize Width and height of every frame.
+     * @param frameDuration Milliseconds per frame.
+     * @param autoAnimate Whether the frames are meant to loop.
+     * @return The ID of the table, the same for every identical table.
+     * @throws std::length_error when every ID is taken.
+     */
+    AnimationID animation(
+        std::vector<vec2> frames, vec2 frameSize, int frameDuration,
+        bool autoAnimate)
+    {
+        SpriteAnimation table{
+            std::move(frames), frameSize, frameDuration, autoAnimate};
+        std::string key = keyOf(table);
+        auto it = animationIDs.find(key);
+        if (it != animationIDs.end()) {
+            return it->second;
+        }
+        const AnimationID id = nextID<AnimationID>(animations.size());
+        animations.push_back(std::move(table));
+        animationIDs.emplace(std::move(key), id);
+        return id;
+    }
+
+    /// @brief Returns the frame table interned as `id`.
+    const SpriteAnimation& animation(AnimationID id) const
+    {
+        return animations[id];
+    }
+
+    /// @brief Returns the number of interned sheets, the empty one included.
+    size_t sheetCount() const
+    {
+        return sheetPaths.size();
+    }
+
+    /// @brief Returns the number of interned frame tables, the empty one
+    /// included.
+    size_t animationCount() const
+    {
+        return animations.size();
+    }
+
+   private:
+    template <typename ID>
+    static ID nextID(size_t count)
+    {
+        if (count > std::numeric_limits<ID>::max()) {
+            throw std::length_error("[AssetRegistry] Too many assets");
+        }
+        return static_cast<ID>(count);
+    }
+
+    /// @brief Byte image of a frame table, used to find identical ones.
+    static std::string keyOf(const SpriteAnimation& table)
+    {
+        std::string key(
+            sizeof(vec2) * (table.frames.size() + 1) + sizeof(int) + 1, '\0');
+        char* out = key.data();
+        std::memcpy(out, &table.frameSize, sizeof(vec2));
+        out += sizeof(vec2);
+        std::memcpy(out, &table.frameDuration, sizeof(int));
+        out += sizeof(int);
+        *out++ = table.autoAnimate ? 1 : 0;
+        if (!table.frames.empty()) {
+            std::memcpy(
+                out, table.frames.data(), sizeof(vec2) * table.frames.size());
+        }
+        return key;
+    }
+
+    std::vector<std::string> sheetPaths;                ///< By SheetID.
+    std::unordered_map<std::string, SheetID> sheetIDs;  ///< By path.
+    std::vector<SpriteAnimation> animations;            ///< By AnimationID.
+    std::unordered_map<std::string, AnimationID>
+        animationIDs;  ///< By keyOf() image.
+};
+}  // namespace GameEngine
@@ -11,4 +11,5 @@ struct ScoreValue : public Component<ScoreValue>
     static constexpr const char* Name = "ScoreValue";
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<ScoreValue>);
 }  // namespace GameEngine
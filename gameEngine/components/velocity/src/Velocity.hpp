@@ -150,5 +150,6 @@ struct Velocity : public Component<Velocity>
      */
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<Velocity>);
 
 }  // namespace GameEngine
@@ -0,0 +1,598 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Component.hpp"
+#include "EntityManager.hpp"
+#include "Types.hpp"
+
+/**
+ * @enum StorageMode
+ * @brief Storage backend used for a component type.
+ */
+enum class StorageMode
+{
+    Default,    ///< Use the default mode of the `Registry`.
+    SparseSet,  ///< One SparseSet pool per component type.
+    Archetype   ///< Chunked SoA storage shared by entities of equal layout.
+};
+
+/**
+ * @struct ComponentStorage
+ * @brief Per-component storage selection, specialize to force a backend.
+ *
+ * Example:
+ * ```cpp
+ * template <>
+ * struct ComponentStorage<Position>
+ * {
+ *     static constexpr StorageMode mode = StorageMode::Archetype;
+ * };
+ * ```
+ */
+template <typename Component>
+struct ComponentStorage
+{
+    static constexpr StorageMode mode = StorageMode::Default;
+};
+
+/**
+ * @struct ColumnType
+ * @brief Type-erased operations needed to store a component in a column.
+ *
+ * Columns of trivial components (see `isTrivialComponent`) are moved with
+ * memcpy and never destroyed.
+ */
+struct ColumnType
+{
+    size_t size = 0;
+    size_t align = 0;
+    bool trivial = false;
+    void (*moveConstruct)(void* dst, void* src) = nullptr;
+    void (*destroy)(void* ptr) = nullptr;
+
+    /// @brief Builds the column operations of `Component`.
+    template <typename Component>
+    static ColumnType of()
+    {
+        static_assert(
+            alignof(Component) <= alignof(std::max_align_t),
+            "Over-aligned components cannot be stored in chunks");
+
+        ColumnType type;
+        type.size = sizeof(Component);
+        type.align = alignof(Component);
+        type.trivial = isTrivialComponent<Component>;
+        type.moveConstruct = [](void* dst, void* src) {
+            new (dst) Component(std::move(*static_cast<Component*>(src)));
+        };
+        type.destroy = [](void* ptr) {
+            static_cast<Component*>(ptr)->~Component();
+        };
+        return type;
+    }
+};
+
+/**
+ * @class Archetype
+ * @brief Every entity holding exactly one set of archetype-stored components.
+ *
+ * Rows are packed into fixed-size chunks (16 KiB by default). Inside a chunk,
+ * the entity IDs and each component live in their own contiguous column
+ * (SoA), so iterating a chunk walks a few dense arrays side by side.
+ * Erasing a row moves the last row into the hole, like a SparseSet.
+ */
+class Archetype
+{
+   public:
+    using Entity = EntityManager::Entity;
+
+    /// @brief Size in bytes of one chunk.
+    static constexpr size_t CHUNK_BYTES = 16 * 1024;
+
+    Archetype(
+        const ComponentSignature& signature,
+        const std::vector<ColumnType>& types)
+        : layout(signature)
+    {
+        columnOf.fill(-1);
+        forEachComponent(signature, [&](ComponentID id) {
+            columnOf[id] = static_cast<int>(columns.size());
+            columns.push_back({id, types[id], 0});
+        });
+
+        rowsPerChunk = CHUNK_BYTES / rowBytes();
+        while (rowsPerChunk > 1 && layoutBytes(rowsPerChunk) > CHUNK_BYTES) {
+            rowsPerChunk--;
+        }
+        rowsPerChunk = std::max<size_t>(rowsPerChunk, 1);
+        chunkBytes = std::max(CHUNK_BYTES, layoutBytes(rowsPerChunk));
+        layoutBytes(rowsPerChunk, true);
+
+        addEdges.resize(MAX_COMPONENTS, nullptr);
+        removeEdges.resize(MAX_COMPONENTS, nullptr);
+    }
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    ~Archetype()
+    {
+        clear();
+    }
+
+    /// @brief Returns the set of components stored in this archetype.
+    const ComponentSignature& signature() const
+    {
+        return layout;
+    }
+
+    /// @brief Returns the number of entities stored.
+    size_t size() const
+    {
+        return count;
+    }
+
+    /// @brief Returns the number of rows that fit in one chunk.
+    size_t chunkCapacity() const
+    {
+        return rowsPerChunk;
+    }
+
+    /// @brief Returns the number of allocated chunks.
+    size_t chunkCount() const
+    {
+        return chunks.size();
+    }
+
+    /// @brief Returns the number of live rows in chunk `chunk`.
+    size_t rowsIn(size_t chunk) const
+    {
+        const size_t first = chunk * rowsPerChunk;
+        return first >= count ? 0 : std::min(rowsPerChunk, count - first);
+    }
+
+    /// @brief Returns the column holding component `id`, or -1.
+    int column(ComponentID id) const
+    {
+        return id < columnOf.size() ? columnOf[id] : -1;
+    }
+
+    /// @brief Returns the entity column of chunk `chunk`.
+    Entity* entities(size_t chunk)
+    {
+        return reinterpret_cast<Entity*>(chunks[chunk].get());
+    }
+
+    /// @brief Returns the first element of column `col` in chunk `chunk`.
+    void* columnData(size_t chunk, int col)
+    {
+        return reinterpret_cast<unsigned char*>(chunks[chunk].get()) +
+               columns[col].offset;
+    }
+
+    /// @brief Returns the element of column `col` at global row `row`.
+    void* at(int col, size_t row)
+    {
+        return static_cast<unsigned char*>(
+                   columnData(row / rowsPerChunk, col)) +
+               (row % rowsPerChunk) * columns[col].type.size;
+    }
+
+    /// @brief Returns the entity stored at global row `row`.
+    Entity entityAt(size_t row)
+    {
+        return entities(row / rowsPerChunk)[row % rowsPerChunk];
+    }
+
+    /**
+     * @brief Appends a row for `e`; its components are left unconstructed.
+     * @return The global row index.
+     */
+    size_t append(Entity e)
+    {
+        if (count == chunks.size() * rowsPerChunk) {
+            chunks.emplace_back(
+                new std::max_align_t[chunkBytes / sizeof(std::max_align_t)]);
+        }
+        const size_t row = count++;
+        entities(row / rowsPerChunk)[row % rowsPerChunk] = e;
+        return row;
+    }
+
+    /**
+     * @brief Destroys the components of `row` and fills the hole with the
+     * last row.
+     * @return The entity moved into `row`, or INVALID_ENTITY if none moved.
+     */
+    Entity erase(size_t row)
+    {
+        const size_t last = count - 1;
+
+        for (size_t col = 0; col < columns.size(); ++col) {
+            const ColumnType& type = columns[col].type;
+            void* hole = at(static_cast<int>(col), row);
+            if (type.trivial) {
+                if (row != last) {
+                    std::memcpy(
+                        hole, at(static_cast<int>(col), last), type.size);
+                }
+                continue;
+            }
+            type.destroy(hole);
+            if (row != last) {
+                void* moved = at(static_cast<int>(col), last);
+                type.moveConstruct(hole, moved);
+                type.destroy(moved);
+            }
+        }
+
+        Entity movedEntity = EntityManager::INVALID_ENTITY;
+        if (row != last) {
+            movedEntity = entityAt(last);
+            entities(row / rowsPerChunk)[row % rowsPerChunk] = movedEntity;
+        }
+        count--;
+        return movedEntity;
+    }
+
+    /// @brief Destroys every row and releases the chunks.
+    void clear()
+    {
+        for (size_t row = 0; row < count; ++row) {
+            for (size_t col = 0; col < columns.size(); ++col) {
+                if (!columns[col].type.trivial) {
+                    columns[col].type.destroy(at(static_cast<int>(col), row));
+                }
+            }
+        }
+        count = 0;
+        chunks.clear();
+    }
+
+    /// @brief Returns the heap memory held by the chunks, in bytes.
+    size_t memoryUsage() const
+    {
+        return chunks.size() * chunkBytes;
+    }
+
+   private:
+    friend class ArchetypeStorage;
+
+    /// @brief One SoA column of a chunk.
+    struct Column
+    {
+        ComponentID id;
+        ColumnType type;
+        size_t offset;  ///< Byte offset of the column inside a chunk.
+    };
+
+    /// @brief Bytes used by one row, ignoring alignment padding.
+    size_t rowBytes() const
+    {
+        size_t bytes = sizeof(Entity);
+        for (const auto& col : columns) {
+            bytes += col.type.size;
+        }
+        return bytes;
+    }
+
+    /**
+     * @brief Computes the chunk size needed for `rows` rows, optionally
+     * storing the resulting column offsets.
+     */
+    size_t layoutBytes(size_t rows, bool assign = false)
+    {
+        size_t offset = rows * sizeof(Entity);
+        for (auto& col : columns) {
+            offset = (offset + col.type.align - 1) / col.type.align *
+                     col.type.align;
+            if (assign) {
+                col.offset = offset;
+            }
+            offset += rows * col.type.size;
+        }
+        return offset;
+    }
+
+    ComponentSignature layout;  ///< Components stored by this archetype.
+    std::vector<Column> columns;  ///< Columns, in ComponentID order.
+    std::array<int, MAX_COMPONENTS> columnOf;  ///< ComponentID → column.
+    std::vector<std::unique_ptr<std::max_align_t[]>> chunks;  ///< Row chunks.
+    size_t rowsPerChunk = 1;  ///< Rows that fit in one chunk.
+    size_t chunkBytes = CHUNK_BYTES;  ///< Allocated bytes per chunk.
+    size_t count = 0;  ///< Number of live rows.
+
+    /// @brief Archetype reached by adding / removing one component.
+    std::vector<Archetype*> addEdges;
+    std::vector<Archetype*> removeEdges;
+};
+
+/**
+ * @class ArchetypeStorage
+ * @brief Stores archetype-backed components and tracks where each entity
+ * lives.
+ *
+ * Adding or removing a component moves the entity to the archetype of its
+ * new component set; transitions are cached on the archetypes so the lookup
+ * is only paid once per (archetype, component) pair. This backend suits
+ * components that are rarely added or removed and often iterated together;
+ * the SparseSet backend stays cheaper for frequent add/remove.
+ */
+class ArchetypeStorage
+{
+   public:
+    using Entity = EntityManager::Entity;
+
+    /**
+     * @brief Records the column operations of component `Component`.
+     * @param id Component ID of `Component`.
+     */
+    template <typename Component>
+    void registerType(ComponentID id)
+    {
+        if (id >= types.size()) {
+            types.resize(id + 1);
+            counts.resize(id + 1, 0);
+        }
+        if (!types[id].moveConstruct) {
+            types[id] = ColumnType::of<Component>();
+        }
+    }
+
+    /// @brief Checks if `e` has at least one archetype-stored component.
+    bool contains(Entity e) const
+    {
+        const uint32_t index = EntityManager::indexOf(e);
+        return index < locations.size() && locations[index].archetype;
+    }
+
+    /**
+     * @brief Adds a `Component` to `e`, moving it to its new archetype.
+     *
+     * The new component is constructed before the entity's other components
+     * are moved, so `args` may safely refer to them.
+     *
+     * @return Reference to the component (the existing one if `e` already
+     * has it).
+     */
+    template <typename Component, typename... Args>
+    Component& emplace(Entity e, ComponentID id, Args&&... args)
+    {
+        const uint32_t index = EntityManager::indexOf(e);
+        if (index >= locations.size()) {
+            locations.resize(static_cast<size_t>(index) + 1);
+        }
+        Location from = locations[index];
+
+        if (from.archetype && from.archetype->column(id) >= 0) {
+            return *static_cast<Component*>(
+                from.archetype->at(from.archetype->column(id), from.row));
+        }
+
+        Archetype& to = transition(from.archetype, id, true);
+        const size_t row = to.append(e);
+        Component* component = new (to.at(to.column(id), row))
+            Component(std::forward<Args>(args)...);
+
+        if (from.archetype) {
+            migrate(from, to, row);
+        }
+        locations[index] = {&to, row};
+        counts[id]++;
+        return *component;
+    }
+
+    /**
+     * @brief Removes component `id` from `e`, moving it to its new archetype.
+     * @return True if `e` had the component.
+     */
+    bool remove(Entity e, ComponentID id)
+    {
+        if (!contains(e))
+            return false;
+
+        Location from = locationOf(e);
+        if (from.archetype->column(id) < 0)
+            return false;
+
+        if (from.archetype->signature().count() == 1) {
+            release(from);
+            locationOf(e) = {};
+        } else {
+            Archetype& to = transition(from.archetype, id, false);
+            const size_t row = to.append(e);
+            migrate(from, to, row);
+            locationOf(e) = {&to, row};
+        }
+        counts[id]--;
+        return true;
+    }
+
+    /**
+     * @brief Destroys every archetype-stored component of `e`.
+     */
+    void destroy(Entity e)
+    {
+        if (!contains(e))
+            return;
+
+        forEachComponent(
+            locationOf(e).archetype->signature(),
+            [&](ComponentID id) { counts[id]--; });
+        release(locationOf(e));
+        locationOf(e) = {};
+    }
+
+    /**
+     * @brief Returns the `Component` of `e`.
+     * @warning Undefined behavior if `e` does not have this component.
+     */
+    template <typename Component>
+    Component& get(Entity e, ComponentID id)
+    {
+        const Location& location = locationOf(e);
+        return *static_cast<Component*>(
+            location.archetype->at(location.archetype->column(id), location.row));
+    }
+
+    /// @brief Const version of get().
+    template <typename Component>
+    const Component& get(Entity e, ComponentID id) const
+    {
+        const Location& location = locationOf(e);
+        return *static_cast<const Component*>(
+            location.archetype->at(location.archetype->column(id), location.row));
+    }
+
+    /// @brief Returns the number of entities holding component `id`.
+    size_t count(ComponentID id) const
+    {
+        return id < counts.size() ? counts[id] : 0;
+    }
+
+    /// @brief Returns the number of archetypes created so far.
+    size_t archetypeCount() const
+    {
+        return ordered.size();
+    }
+
+    /**
+     * @brief Calls `func(Archetype&)` for every non-empty archetype holding
+     * at least the components of `required`.
+     */
+    template <typename Func>
+    void forEachMatching(const ComponentSignature& required, Func&& func)
+    {
+        for (size_t i = 0; i < ordered.size(); ++i) {
+            Archetype& archetype = *ordered[i];
+            if (archetype.size() != 0 &&
+                (archetype.signature() & required) == required) {
+                func(archetype);
+            }
+        }
+    }
+
+    /// @brief Returns the heap memory held by all chunks, in bytes.
+    size_t memoryUsage() const
+    {
+        size_t bytes = 0;
+        for (const auto* archetype : ordered) {
+            bytes += archetype->memoryUsage();
+        }
+        return bytes;
+    }
+
+    /// @brief Destroys every stored component and archetype.
+    void clear()
+    {
+        ordered.clear();
+        archetypes.clear();
+        locations.clear();
+        std::fill(counts.begin(), counts.end(), 0);
+    }
+
+   private:
+    /// @brief Archetype and row of an entity.
+    struct Location
+    {
+        Archetype* archetype = nullptr;
+        size_t row = 0;
+    };
+
+    /// @brief Returns the location of `e`, looked up by slot index.
+    Location& locationOf(Entity e)
+    {
+        return locations[EntityManager::indexOf(e)];
+    }
+
+    /// @brief Const version of locationOf().
+    const Location& locationOf(Entity e) const
+    {
+        return locations[EntityManager::indexOf(e)];
+    }
+
+    /**
+     * @brief Returns the archetype reached from `from` by adding or removing
+     * component `id`, creating it on first use.
+     */
+    Archetype& transition(Archetype* from, ComponentID id, bool add)
+    {
+        if (from) {
+            Archetype*& edge = add ? from->addEdges[id] : from->removeEdges[id];
+            if (!edge) {
+                ComponentSignature signature = from->signature();
+                signature.set(id, add);
+                edge = &find(signature);
+            }
+            return *edge;
+        }
+
+        ComponentSignature signature;
+        signature.set(id);
+        return find(signature);
+    }
+
+    /// @brief Returns the archetype of `signature`, creating it if needed.
+    Archetype& find(const ComponentSignature& signature)
+    {
+        auto it = archetypes.find(signature);
+        if (it != archetypes.end()) {
+            return *it->second;
+        }
+
+        auto archetype = std::make_unique<Archetype>(signature, types);
+        Archetype* ptr = archetype.get();
+        archetypes.emplace(signature, std::move(archetype));
+        ordered.push_back(ptr);
+        return *ptr;
+    }
+
+    /**
+     * @brief Moves the components `from` and `to` share into row `row` of
+     * `to`, then frees the old row.
+     */
+    void migrate(const Location& from, Archetype& to, size_t row)
+    {
+        Archetype& source = *from.archetype;
+        for (const auto& col : source.columns) {
+            const int target = to.column(col.id);
+            if (target < 0)
+                continue;
+
+            void* dst = to.at(target, row);
+            void* src = source.at(source.column(col.id), from.row);
+            if (col.type.trivial) {
+                std::memcpy(dst, src, col.type.size);
+            } else {
+                col.type.moveConstruct(dst, src);
+            }
+        }
+        release(from);
+    }
+
+    /// @brief Erases a row and fixes the location of the row moved into it.
+    void release(const Location& location)
+    {
+        const Entity moved = location.archetype->erase(location.row);
+        if (moved != EntityManager::INVALID_ENTITY) {
+            locationOf(moved).row = location.row;
+        }
+    }
+
+    std::vector<ColumnType> types;  ///< Column operations, by ComponentID.
+    std::vector<size_t> counts;  ///< Live components, by ComponentID.
+    std::vector<Location>
+        locations;  ///< Location of each entity, by slot index.
+    std::unordered_map<ComponentSignature, std::unique_ptr<Archetype>>
+        archetypes;  ///< Archetypes, by component set.
+    std::vector<Archetype*> ordered;  ///< Archetypes in creation order.
+};
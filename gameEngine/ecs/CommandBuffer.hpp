@@ -0,0 +1,196 @@
+#pragma once
+
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ComponentRegistry.hpp"
+#include "EntityManager.hpp"
+#include "Types.hpp"
+
+class Prefab;
+class Registry;
+
+/**
+ * @struct IStagedComponents
+ * @brief Type-erased list of components waiting to be emplaced.
+ */
+struct IStagedComponents
+{
+    virtual ~IStagedComponents() = default;
+
+    /**
+     * @brief Emplaces every staged component into `registry`, then clears.
+     * @return Number of components taken from the list.
+     */
+    virtual size_t playback(Registry& registry) = 0;
+
+    /// @brief Drops every staged component.
+    virtual void clear() = 0;
+};
+
+/**
+ * @struct StagedComponents
+ * @brief Components of one type recorded by a CommandBuffer.
+ *
+ * playback() is defined in Registry.hpp, once `Registry` is complete.
+ */
+template <typename Component>
+struct StagedComponents : IStagedComponents
+{
+    using Entity = EntityManager::Entity;
+
+    size_t playback(Registry& registry) override;
+
+    void clear() override
+    {
+        items.clear();
+    }
+
+    std::vector<std::pair<Entity, Component>> items;
+
+    /// @brief Batch being played back, swapped out of `items`.
+    std::vector<std::pair<Entity, Component>> replaying;
+};
+
+/**
+ * @class CommandBuffer
+ * @brief Records structural changes to apply later at a sync point.
+ *
+ * Systems that create, destroy or change the components of entities while
+ * iterating record those changes here instead of touching the pools. The
+ * `Registry` plays every buffer back in one batch after each system:
+ *  1. staged components, grouped by component type,
+ *  2. component removals, sorted by type then entity,
+ *  3. entity destructions, sorted and deduplicated.
+ *
+ * Commands recorded for an entity that is no longer valid at playback (see
+ * `Registry::valid`) are dropped, even if its slot was reused meanwhile.
+ *
+ * create() returns a real entity ID right away so that components can be
+ * recorded for it; the entity simply has no components until playback.
+ *
+ * Each thread records into its own buffer (see `Registry::commands()`), so
+ * recording needs no synchronization.
+ */
+class CommandBuffer
+{
+   public:
+    using Entity = EntityManager::Entity;
+
+    explicit CommandBuffer(Registry& registry) : registry(registry) {}
+
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    /**
+     * @brief Allocates a new entity; its components are recorded separately.
+     * @return The new entity ID, valid immediately.
+     */
+    Entity create();
+
+    /**
+     * @brief Allocates a new entity and records the components of `prefab`
+     * for it. Defined in Prefab.hpp.
+     * @return The new entity ID, valid immediately.
+     */
+    Entity spawn(const Prefab& prefab);
+
+    /**
+     * @brief spawn() calling `init(Entity)` first: components it records for
+     * the entity replace the defaults of `prefab`.
+     */
+    template <typename Init>
+    Entity spawn(const Prefab& prefab, Init&& init);
+
+    /**
+     * @brief Records the construction of a `Component` for entity `e`.
+     * @param e Target entity.
+     * @param args Arguments forwarded to the component constructor.
+     */
+    template <typename Component, typename... Args>
+    void emplace(Entity e, Args&&... args)
+    {
+        ComponentID id = ComponentRegistry::typeID<Component>();
+
+        if (id >= staged.size()) {
+            staged.resize(id + 1);
+        }
+        if (!staged[id]) {
+            staged[id] = std::make_unique<StagedComponents<Component>>();
+        }
+
+        static_cast<StagedComponents<Component>*>(staged[id].get())
+            ->items.emplace_back(
+                std::piecewise_construct, std::forward_as_tuple(e),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+        pending++;
+    }
+
+    /**
+     * @brief Records the removal of the `Component` of entity `e`.
+     * Removals are applied after every staged emplace.
+     */
+    template <typename Component>
+    void remove(Entity e)
+    {
+        removals.emplace_back(ComponentRegistry::typeID<Component>(), e);
+        pending++;
+    }
+
+    /**
+     * @brief Records the destruction of entity `e`.
+     * Destroying the same entity several times is harmless.
+     */
+    void destroy(Entity e)
+    {
+        destructions.push_back(e);
+        pending++;
+    }
+
+    /// @brief Checks if no command is waiting for playback.
+    bool empty() const
+    {
+        return pending == 0;
+    }
+
+    /// @brief Returns the number of recorded commands.
+    size_t size() const
+    {
+        return pending;
+    }
+
+    /**
+     * @brief Drops every recorded command without applying it.
+     *
+     * Entities returned by create() stay allocated.
+     */
+    void clear()
+    {
+        for (auto& components : staged) {
+            if (components) {
+                components->clear();
+            }
+        }
+        removals.clear();
+        destructions.clear();
+        pending = 0;
+    }
+
+   private:
+    friend class Registry;
+
+    Registry& registry;  ///< Registry the commands are played back into.
+
+    /// @brief Staged components, indexed by ComponentID.
+    std::vector<std::unique_ptr<IStagedComponents>> staged;
+
+    /// @brief Recorded (component, entity) removals.
+    std::vector<std::pair<ComponentID, Entity>> removals;
+
+    /// @brief Recorded entity destructions.
+    std::vector<Entity> destructions;
+
+    size_t pending = 0;  ///< Number of recorded commands.
+};
@@ -2,15 +2,18 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include "Types.hpp"
 
 /**
  * @class IComponent
- * @brief Interface de base pour tous les composants ECS.
+ * @brief Interface de base des composants chargés depuis des bibliothèques
+ * partagées.
  *
- * Permet l'identification et la gestion dynamique des composants
- * chargés depuis des bibliothèques partagées.
+ * Les composants eux-mêmes n'en héritent pas (voir `Component`) : les
+ * bibliothèques exportent un `ComponentBox` qui les enveloppe.
  */
 class IComponent
 {
@@ -34,14 +37,72 @@ class IComponent
      * @return Pointeur vers une nouvelle instance clonée
      */
     virtual std::unique_ptr<IComponent> clone() const = 0;
+
+    /**
+     * @brief Retourne l'adresse du composant enveloppé.
+     */
+    virtual void* data() = 0;
 };
 
+/**
+ * @struct ComponentTraits
+ * @brief Métadonnées d'un type de composant, hors de ses instances.
+ *
+ * Lit par défaut `T::Name` et `T::Version` ; à spécialiser pour les types
+ * qui ne les déclarent pas.
+ *
+ * @tparam T Type du composant
+ */
+template <typename T>
+struct ComponentTraits
+{
+    /// @brief Nom unique du composant.
+    static constexpr const char* name()
+    {
+        return T::Name;
+    }
+
+    /// @brief Version du composant.
+    static constexpr const char* version()
+    {
+        return T::Version;
+    }
+
+    /// @brief Copie profonde d'une instance.
+    static T clone(const T& component)
+    {
+        return component;
+    }
+};
+
+/**
+ * @brief Vrai si `T` peut être copié et déplacé octet par octet.
+ *
+ * Le stockage s'en sert pour remplacer les constructeurs et destructeurs par
+ * des `memcpy`. Les composants simples le vérifient avec un `static_assert`
+ * placé après leur définition.
+ */
+template <typename T>
+inline constexpr bool isTrivialComponent =
+    std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>;
+
+/**
+ * @brief Vrai si `T` est un tag : un composant sans aucune donnée.
+ *
+ * Le stockage ne garde alors que l'appartenance des entités, sans tableau de
+ * composants ; `get` n'existe pas pour un tag, mais `each` l'accepte comme
+ * filtre. Les tags le vérifient avec un `static_assert`.
+ */
+template <typename T>
+inline constexpr bool isTagComponent = std::is_empty_v<T>;
+
 /**
  * @class Component
- * @brief Classe de base CRTP pour les composants concrets.
+ * @brief Classe de base CRTP des composants concrets.
  *
- * Simplifie l'implémentation des composants en fournissant
- * automatiquement les méthodes de l'interface.
+ * Base vide et sans fonction virtuelle : elle n'ajoute rien à la taille du
+ * composant, qui reste trivialement copiable si ses membres le sont. Les
+ * métadonnées passent par `ComponentTraits`.
  *
  * @tparam Derived Le type du composant dérivé
  *
@@ -57,28 +118,60 @@ class IComponent
  *     static constexpr const char* Name = "Velocity";
  *     static constexpr const char* Version = "1.0.0";
  * };
+ * static_assert(isTrivialComponent<Velocity>);
  * ```
  */
 template <typename Derived>
-class Component : public IComponent
+class Component
 {
    public:
-    virtual ~Component() = default;
+    /// @brief Nom du composant, lu dans `ComponentTraits`.
+    static constexpr const char* getComponentName()
+    {
+        return ComponentTraits<Derived>::name();
+    }
+
+    /// @brief Version du composant, lue dans `ComponentTraits`.
+    static constexpr const char* getVersion()
+    {
+        return ComponentTraits<Derived>::version();
+    }
+};
+
+/**
+ * @class ComponentBox
+ * @brief Enveloppe un composant derrière `IComponent` pour l'export depuis
+ * une bibliothèque partagée.
+ *
+ * @tparam T Type du composant enveloppé
+ */
+template <typename T>
+class ComponentBox : public IComponent
+{
+   public:
+    explicit ComponentBox(T value = T()) : value(std::move(value)) {}
 
     const char* getComponentName() const override
     {
-        return Derived::Name;
+        return ComponentTraits<T>::name();
     }
 
     const char* getVersion() const override
     {
-        return Derived::Version;
+        return ComponentTraits<T>::version();
     }
 
     std::unique_ptr<IComponent> clone() const override
     {
-        return std::make_unique<Derived>(static_cast<const Derived&>(*this));
+        return std::make_unique<ComponentBox>(ComponentTraits<T>::clone(value));
     }
+
+    void* data() override
+    {
+        return &value;
+    }
+
+    T value;  ///< Composant enveloppé.
 };
 
 /**
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+
+#include "EntityManager.hpp"
+#include "SparseSet.hpp"
+
+class IGroup;
+
+/**
+ * @struct IComponentPool
+ * @brief Abstract base for all component pools.
+ *
+ * Gives the `Registry` type-erased access to every pool (entity removal,
+ * size queries) and records which groups watch or own the pool.
+ */
+struct IComponentPool
+{
+    using Entity = EntityManager::Entity;
+
+    virtual ~IComponentPool() = default;
+    virtual void remove(Entity e) = 0;
+    virtual bool contains(Entity e) const = 0;
+    virtual size_t size() const = 0;
+    virtual Entity getEntityAt(size_t index) const = 0;
+
+    /// @brief Groups notified when an entity gains or loses this component.
+    std::vector<IGroup*> groups;
+
+    /// @brief Group keeping this pool packed, or nullptr if none owns it.
+    IGroup* owner = nullptr;
+};
+
+/**
+ * @struct ComponentPool
+ * @brief Templated component pool for a specific component type.
+ * Uses SparseSet for efficient storage and lookup.
+ *
+ * @tparam Allocator Allocator of the SparseSet; the default takes memory from
+ * the resource given to the `Registry`.
+ */
+template <
+    typename Component,
+    typename Allocator = std::pmr::polymorphic_allocator<Component>>
+struct ComponentPool : IComponentPool
+{
+    using Storage = SparseSet<Entity, Component, Allocator>;
+
+    ComponentPool() = default;
+
+    explicit ComponentPool(const Allocator& allocator) : storage(allocator) {}
+
+    Storage storage;
+
+    void remove(Entity e) override
+    {
+        storage.erase(e);
+    }
+    bool contains(Entity e) const override
+    {
+        return storage.contains(e);
+    }
+    size_t size() const override
+    {
+        return storage.size();
+    }
+    Entity getEntityAt(size_t index) const override
+    {
+        return storage.begin()[index];
+    }
+
+    template <typename... Args>
+    Component& emplace(Entity e, Args&&... args)
+    {
+        return storage.emplace(e, std::forward<Args>(args)...);
+    }
+
+    void erase(Entity e)
+    {
+        storage.erase(e);
+    }
+    Component& get(Entity e)
+    {
+        return storage.get(e);
+    }
+    const Component& get(Entity e) const
+    {
+        return storage.get(e);
+    }
+    bool empty() const
+    {
+        return storage.empty();
+    }
+
+    auto begin()
+    {
+        return storage.begin();
+    }
+    auto end()
+    {
+        return storage.end();
+    }
+    auto begin() const
+    {
+        return storage.begin();
+    }
+    auto end() const
+    {
+        return storage.end();
+    }
+};
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <type_traits>
 #include <typeindex>
 #include <unordered_map>
-#include <vector>
 
 #include "Types.hpp"
 
@@ -21,8 +24,13 @@
  * The registry follows the Singleton pattern — only one instance exists
  * globally.
  *
- * **Optimization**: Uses unordered_map for O(1) average lookup instead of O(n)
- * linear search.
+ * **Optimization**: every statically known type caches its ID in a
+ * constant-initialized atomic slot, so `typeID<T>()` is a single load once
+ * the type has been seen. The hash maps are only touched on the first use of
+ * a type and for name-based (plugin) lookups.
+ *
+ * **Thread safety**: all lookups may be performed concurrently; registrations
+ * are serialized by an internal mutex.
  */
 class ComponentRegistry
 {
@@ -37,10 +45,32 @@ class ComponentRegistry
         return inst;
     }
 
+    /**
+     * @brief Returns the unique ID of component type `T`, assigning it on
+     * first use.
+     *
+     * Hot path of every `Registry` access: no singleton lookup and no
+     * static-init guard, only an acquire load of the type's slot.
+     *
+     * @tparam T Component type (cv-qualifiers are ignored).
+     * @return The unique ComponentID for the type `T`.
+     */
+    template <typename T>
+    static ComponentID typeID()
+    {
+        using Type = std::remove_cv_t<T>;
+        ComponentID id = TypeSlot<Type>::id.load(std::memory_order_acquire);
+        if (id != INVALID_ID) {
+            return id;
+        }
+        return instance().registerType<Type>();
+    }
+
     /**
      * @brief Retrieves or creates a unique ID for the given component type `T`.
      *
      * The ID is generated once per type and cached for all future calls.
+     * Same ID as typeID(), which the `Registry` hot paths use directly.
      *
      * @tparam T Component type.
      * @return The unique ComponentID for the type `T`.
@@ -48,8 +78,7 @@ class ComponentRegistry
     template <typename T>
     ComponentID getOrCreateID()
     {
-        // Each component type caches its ID statically for speed
-        static ComponentID cachedID = computeID<T>();
+        static const ComponentID cachedID = typeID<T>();
         return cachedID;
     }
 
@@ -64,6 +93,8 @@ class ComponentRegistry
      */
     ComponentID getOrCreateID(const std::string& name)
     {
+        std::lock_guard<std::mutex> lock(mutex);
+
         auto it = nameToID.find(name);
         if (it != nameToID.end()) {
             return it->second;
@@ -89,7 +120,9 @@ class ComponentRegistry
      */
     const std::string& getName(ComponentID id) const
     {
-        static std::string empty;
+        static const std::string empty;
+
+        std::lock_guard<std::mutex> lock(mutex);
         if (id < idToName.size()) {
             return idToName[id];
         }
@@ -104,6 +137,8 @@ class ComponentRegistry
      */
     ComponentID getID(const std::string& name) const
     {
+        std::lock_guard<std::mutex> lock(mutex);
+
         auto it = nameToID.find(name);
         if (it != nameToID.end()) {
             return it->second;
@@ -124,15 +159,40 @@ class ComponentRegistry
     {
         typeToID.reserve(64);
         nameToID.reserve(64);
-        idToName.reserve(64);
+    }
+
+    /**
+     * @brief Per-type ID slot, constant-initialized to INVALID_ID so reading
+     * it never goes through a static-init guard.
+     */
+    template <typename T>
+    struct TypeSlot
+    {
+        static inline std::atomic<ComponentID> id{INVALID_ID};
+    };
+
+    /**
+     * @brief Slow path of typeID(): assigns the ID of `T` under the lock and
+     * publishes it in the type's slot.
+     */
+    template <typename T>
+    ComponentID registerType()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        ComponentID id = computeID<T>();
+        TypeSlot<T>::id.store(id, std::memory_order_release);
+        return id;
     }
 
     /**
      * @brief Computes a new unique ID for a type `T`, or returns the existing
      * one.
      *
-     * This is called only once per component type.
-     * It uses `std::type_index` to identify unique C++ types at runtime.
+     * Called with the lock held, once per component type and module: the
+     * map keeps IDs consistent when several shared objects instantiate the
+     * slot of the same type. It uses `std::type_index` to identify unique C++
+     * types at runtime.
      *
      * @tparam T Component type.
      * @return Unique ComponentID for the type.
@@ -158,6 +218,8 @@ class ComponentRegistry
         return id;
     }
 
+    mutable std::mutex mutex;  ///< Serializes registrations and name lookups.
+
     ComponentID nextID = 0;  ///< Next available unique component ID counter.
 
     /// @brief Maps C++ type_index → ComponentID (O(1) lookup with hash map).
@@ -167,6 +229,6 @@ class ComponentRegistry
     std::unordered_map<std::string, ComponentID> nameToID;
 
     /// @brief Reverse lookup: maps ComponentID → string name (O(1) indexed
-    /// access).
-    std::vector<std::string> idToName;
+    /// access). A deque keeps returned references valid while it grows.
+    std::deque<std::string> idToName;
 };
\ No newline at end of file
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <deque>
+#include <stdexcept>
 #include <vector>
 
+#include "Types.hpp"
+
 /**
  * @class EntityManager
  * @brief Handles creation and destruction of entities within the ECS framework.
@@ -11,7 +15,20 @@
  * reusing destroyed entity IDs for efficiency, and keeping track of
  * how many entities are currently alive.
  *
- * Entities are represented by simple unsigned integers (uint32_t).
+ * Entities are versioned handles packed in an unsigned integer (uint32_t):
+ * the low `ENTITY_INDEX_BITS` bits hold the slot index, the high bits the
+ * generation of that slot. Destroying an entity bumps the generation of its
+ * slot, so handles kept by other code (player slots, snapshots, command
+ * buffers) can be checked in O(1) with valid() instead of silently pointing
+ * at the next entity reusing the slot.
+ *
+ * Freed slots are recycled in FIFO order: the oldest freed slot is reused
+ * first, which spreads reuse over every free slot and delays the wrap of
+ * their 8-bit generation.
+ *
+ * It also stores the component signature of every entity, kept up to date by
+ * the `Registry`, so membership queries and destruction never have to probe
+ * the component pools.
  */
 class EntityManager
 {
@@ -22,41 +39,131 @@ class EntityManager
     /// @brief Special invalid entity identifier (used as a null handle).
     static constexpr Entity INVALID_ENTITY = static_cast<Entity>(-1);
 
+    /// @brief Number of slots; the last index is left to INVALID_ENTITY.
+    static constexpr size_t MAX_ENTITIES = ENTITY_INDEX_MASK;
+
+    /// @brief Returns the slot index of handle `e`.
+    static constexpr uint32_t indexOf(Entity e)
+    {
+        return e & ENTITY_INDEX_MASK;
+    }
+
+    /// @brief Returns the generation of handle `e`.
+    static constexpr uint32_t generationOf(Entity e)
+    {
+        return e >> ENTITY_INDEX_BITS;
+    }
+
+    /// @brief Builds the handle of slot `index` at `generation`.
+    static constexpr Entity makeEntity(uint32_t index, uint32_t generation)
+    {
+        return (generation << ENTITY_INDEX_BITS) | (index & ENTITY_INDEX_MASK);
+    }
+
     /**
      * @brief Creates a new entity.
      *
-     * If there are recycled entity IDs available in the free list,
-     * one of those will be reused. Otherwise, a new unique ID is generated.
+     * If there are recycled slots available in the free list, the oldest one
+     * is reused with its next generation. Otherwise, a new slot is used.
      *
-     * @return The newly created entity ID.
+     * @return The newly created entity handle.
+     * @throws std::length_error if all MAX_ENTITIES slots are alive.
      */
     Entity create()
     {
+        Entity e;
         if (!freeList.empty()) {
-            Entity e = freeList.back();
-            freeList.pop_back();
-            aliveCount++;
-            return e;
+            e = freeList.front();
+            freeList.pop_front();
+            handles[indexOf(e)] = e;
+        } else {
+            if (handles.size() >= MAX_ENTITIES) {
+                throw std::length_error(
+                    "[EntityManager] No entity index left");
+            }
+            e = makeEntity(static_cast<uint32_t>(handles.size()), 0);
+            handles.push_back(e);
         }
 
         aliveCount++;
-        return nextEntity++;
+        return e;
     }
 
     /**
-     * @brief Destroys an entity, making its ID available for reuse.
+     * @brief Destroys an entity, making its slot available for reuse.
      *
      * This does not automatically remove components from the registry;
-     * it simply marks the entity ID as reusable.
+     * it simply marks the slot as reusable. Destroying a handle that is no
+     * longer valid does nothing.
      *
      * @param e Entity to destroy.
      */
     void destroy(Entity e)
     {
-        freeList.push_back(e);
+        if (!valid(e))
+            return;
+
+        const uint32_t index = indexOf(e);
+        if (index < signatures.size()) {
+            signatures[index].reset();
+        }
+        handles[index] = INVALID_ENTITY;
+        freeList.push_back(makeEntity(index, generationOf(e) + 1));
         aliveCount--;
     }
 
+    /**
+     * @brief Checks whether `e` is the handle of an entity still alive.
+     *
+     * False for INVALID_ENTITY, for handles never issued and for handles
+     * whose entity was destroyed, even once its slot has been reused.
+     */
+    bool valid(Entity e) const
+    {
+        const uint32_t index = indexOf(e);
+        return index < handles.size() && handles[index] == e;
+    }
+
+    /**
+     * @brief Returns the component signature of an entity.
+     * @param e Entity to query.
+     * @return The set of component IDs attached to `e` (empty if `e` is not
+     * valid).
+     */
+    const ComponentSignature& signature(Entity e) const
+    {
+        const uint32_t index = indexOf(e);
+        return index < signatures.size() && handles[index] == e
+                   ? signatures[index]
+                   : emptySignature;
+    }
+
+    /**
+     * @brief Marks component `id` as attached to entity `e`.
+     * @warning `e` must be valid.
+     */
+    void addComponent(Entity e, ComponentID id)
+    {
+        const uint32_t index = indexOf(e);
+        if (index == signatures.size()) {
+            signatures.emplace_back();
+        } else if (index > signatures.size()) {
+            signatures.resize(static_cast<size_t>(index) + 1);
+        }
+        signatures[index].set(id);
+    }
+
+    /**
+     * @brief Marks component `id` as detached from entity `e`.
+     */
+    void removeComponent(Entity e, ComponentID id)
+    {
+        const uint32_t index = indexOf(e);
+        if (index < signatures.size()) {
+            signatures[index].reset(id);
+        }
+    }
+
     /**
      * @brief Returns the number of currently active (alive) entities.
      * @return Number of active entities.
@@ -67,7 +174,7 @@ class EntityManager
     }
 
     /**
-     * @brief Reserves memory for a given number of entities in the free list.
+     * @brief Reserves memory for a given number of entities.
      *
      * This does not create entities; it just preallocates memory to avoid
      * reallocations.
@@ -75,7 +182,8 @@ class EntityManager
      */
     void reserve(size_t capacity)
     {
-        freeList.reserve(capacity);
+        handles.reserve(capacity);
+        signatures.reserve(capacity);
     }
 
     /**
@@ -87,15 +195,22 @@ class EntityManager
      */
     void clear()
     {
-        nextEntity = 0;
         aliveCount = 0;
+        handles.clear();
         freeList.clear();
+        signatures.clear();
     }
 
    private:
-    Entity nextEntity =
-        0;  ///< Next entity ID to assign when creating a new entity.
     size_t aliveCount = 0;  ///< Number of currently active entities.
     std::vector<Entity>
-        freeList;  ///< Pool of destroyed entities ready for reuse.
-};
\ No newline at end of file
+        handles;  ///< Live handle of each slot, INVALID_ENTITY once freed.
+    std::deque<Entity>
+        freeList;  ///< Next handle of each freed slot, oldest first.
+    std::vector<ComponentSignature>
+        signatures;  ///< Components attached to each entity, by slot index.
+                     ///< Grown lazily by addComponent().
+
+    /// @brief Signature returned for entities that are not alive.
+    static inline const ComponentSignature emptySignature{};
+};
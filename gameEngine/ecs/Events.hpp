@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @class Events
+ * @brief Double-buffered queue of the `Event`s of the last two updates,
+ * usually kept in the `Resources` of a `Registry`.
+ *
+ * The producing system calls update() once per step before sending, which
+ * drops the events sent before the previous update(). Every event thus
+ * stays readable for a full step, whatever the order the readers run in.
+ *
+ * Each reader keeps its own `Cursor` and gets every event once:
+ * @code
+ * // Producer
+ * auto& hits = registry.resources().getOrEmplace<Events<Hit>>();
+ * hits.update();
+ * hits.send({attacker, target});
+ *
+ * // Reader
+ * registry.resources().get<Events<Hit>>().read(cursor, [&](const Hit& hit) {
+ *     ...
+ * });
+ * @endcode
+ *
+ * Buffers keep their capacity between steps, so a steady stream of events
+ * does not allocate.
+ */
+template <typename Event>
+class Events
+{
+   public:
+    /// @brief Number of events sent before the next one a reader will get.
+    using Cursor = uint64_t;
+
+    /// @brief Queues `event` for the readers.
+    void send(const Event& event)
+    {
+        buffers[current].push_back(event);
+    }
+
+    /// @brief Queues an event built from `args` for the readers.
+    template <typename... Args>
+    Event& emplace(Args&&... args)
+    {
+        return buffers[current].emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Starts a new step: drops the events sent before the previous
+     * update(); those sent since stay readable.
+     */
+    void update()
+    {
+        const Cursor next = end();
+        current ^= 1;
+        buffers[current].clear();
+        starts[current] = next;
+    }
+
+    /**
+     * @brief Calls `func(event)` on every event still held that was sent at
+     * or after `cursor`, oldest first, then moves `cursor` past them.
+     *
+     * Events dropped before the reader caught up are skipped.
+     */
+    template <typename Func>
+    void read(Cursor& cursor, Func&& func) const
+    {
+        for (size_t buffer : {current ^ 1, current}) {
+            const std::vector<Event>& events = buffers[buffer];
+            const Cursor start = starts[buffer];
+            for (size_t i = cursor > start ? size_t(cursor - start) : 0;
+                 i < events.size(); ++i) {
+                func(events[i]);
+            }
+        }
+        cursor = std::max(cursor, end());
+    }
+
+    /// @brief Returns the events sent since the last update().
+    const std::vector<Event>& latest() const
+    {
+        return buffers[current];
+    }
+
+    /// @brief Returns the cursor of the oldest event still held.
+    Cursor begin() const
+    {
+        return starts[current ^ 1];
+    }
+
+    /// @brief Returns the cursor of the next event to be sent.
+    Cursor end() const
+    {
+        return starts[current] + buffers[current].size();
+    }
+
+    /// @brief Returns the number of events still held.
+    size_t size() const
+    {
+        return buffers[0].size() + buffers[1].size();
+    }
+
+    /// @brief Drops every event; cursors stay valid.
+    void clear()
+    {
+        const Cursor next = end();
+        buffers[0].clear();
+        buffers[1].clear();
+        starts[0] = next;
+        starts[1] = next;
+    }
+
+   private:
+    std::vector<Event> buffers[2];  ///< Previous and current step.
+    Cursor starts[2] = {0, 0};  ///< Cursor of the first event of each buffer.
+    size_t current = 0;         ///< Buffer events are sent to.
+};
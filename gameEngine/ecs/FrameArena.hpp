@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * @class FrameArena
+ * @brief Monotonic memory resource for allocations that only live one tick.
+ *
+ * Systems allocate their scratch containers from it (e.g. a
+ * `std::pmr::vector` built on `registry.frame()`), and the `Registry` calls
+ * reset() at the start of every fixed step, which frees everything at once.
+ * deallocate() is a no-op.
+ *
+ * Allocations bump an atomic offset into one block, so systems running
+ * concurrently can share the arena. A request that does not fit goes to an
+ * overflow block taken from the upstream resource; at the next reset() the
+ * block is regrown to hold the whole previous tick, so a steady-state tick
+ * performs no heap allocation.
+ */
+class FrameArena : public std::pmr::memory_resource
+{
+   public:
+    /// @brief Default size of the block, in bytes.
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+    /**
+     * @brief Creates an arena with a block of `capacity` bytes.
+     * @param upstream Resource providing the block and the overflow blocks.
+     */
+    explicit FrameArena(
+        size_t capacity = DEFAULT_CAPACITY,
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : upstream(upstream)
+    {
+        grow(capacity);
+    }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    ~FrameArena() override
+    {
+        releaseOverflow();
+        upstream->deallocate(block, blockSize, alignof(std::max_align_t));
+    }
+
+    /**
+     * @brief Frees every allocation of the current tick.
+     *
+     * If the last tick overflowed, the block is regrown to fit it. Must not
+     * be called while another thread allocates from the arena.
+     */
+    void reset()
+    {
+        const size_t used = offset.load(std::memory_order_relaxed);
+        if (overflowBytes > 0) {
+            const size_t needed = std::min(used, blockSize) + overflowBytes;
+            releaseOverflow();
+            upstream->deallocate(block, blockSize, alignof(std::max_align_t));
+            grow(std::max(needed, blockSize * 2));
+        }
+        peak = std::max(peak, std::min(used, blockSize));
+        offset.store(0, std::memory_order_relaxed);
+    }
+
+    /// @brief Returns the number of bytes taken from the block this tick.
+    size_t used() const
+    {
+        return std::min(offset.load(std::memory_order_relaxed), blockSize);
+    }
+
+    /// @brief Returns the size of the block, in bytes.
+    size_t capacity() const
+    {
+        return blockSize;
+    }
+
+    /// @brief Returns the largest number of block bytes used by a tick.
+    size_t highWaterMark() const
+    {
+        return std::max(peak, used());
+    }
+
+    /// @brief Returns the number of overflow blocks allocated this tick.
+    size_t overflowCount() const
+    {
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        return overflow.size();
+    }
+
+   private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(block);
+        size_t current = offset.load(std::memory_order_relaxed);
+
+        while (current <= blockSize) {
+            const uintptr_t aligned =
+                (base + current + alignment - 1) & ~(uintptr_t(alignment) - 1);
+            const size_t end = static_cast<size_t>(aligned - base) + bytes;
+            if (end > blockSize) {
+                break;
+            }
+            if (offset.compare_exchange_weak(
+                    current, end, std::memory_order_relaxed)) {
+                return reinterpret_cast<void*>(aligned);
+            }
+        }
+
+        // Once a request spills, later ones spill too, so the next reset()
+        // sizes the block for the whole tick.
+        offset.store(blockSize + 1, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        void* memory = upstream->allocate(bytes, alignment);
+        overflow.push_back({memory, bytes, alignment});
+        overflowBytes += bytes + alignment;
+        return memory;
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    /// @brief Allocates a new block of at least `capacity` bytes.
+    void grow(size_t capacity)
+    {
+        blockSize = std::max<size_t>(capacity, 64);
+        block = static_cast<std::byte*>(
+            upstream->allocate(blockSize, alignof(std::max_align_t)));
+    }
+
+    /// @brief Returns every overflow block to the upstream resource.
+    void releaseOverflow()
+    {
+        for (const Overflow& chunk : overflow) {
+            upstream->deallocate(chunk.memory, chunk.bytes, chunk.alignment);
+        }
+        overflow.clear();
+        overflowBytes = 0;
+    }
+
+    /// @brief Allocation served by the upstream resource.
+    struct Overflow
+    {
+        void* memory;
+        size_t bytes;
+        size_t alignment;
+    };
+
+    std::pmr::memory_resource* upstream;  ///< Source of every block.
+    std::byte* block = nullptr;  ///< Block shared by the tick allocations.
+    size_t blockSize = 0;  ///< Size of `block`, in bytes.
+    std::atomic<size_t> offset{0};  ///< First free byte of `block`.
+    size_t peak = 0;  ///< Largest `offset` seen at a reset().
+
+    mutable std::mutex overflowMutex;  ///< Guards the overflow state.
+    std::vector<Overflow> overflow;  ///< Overflow blocks of this tick.
+    size_t overflowBytes = 0;  ///< Bytes requested from overflow blocks.
+};
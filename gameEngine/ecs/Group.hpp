@@ -0,0 +1,298 @@
+#pragma once
+
+#include <tuple>
+
+#include "ComponentPool.hpp"
+#include "JobSystem.hpp"
+#include "Profiler.hpp"
+#include "Types.hpp"
+
+class Registry;
+
+/// @brief Forwards to `Registry::each` (defined in Registry.hpp).
+template <typename... Components, typename Func>
+void eachInRegistry(Registry& registry, Func& func);
+
+/// @brief Forwards to `Registry::parallelEach` (defined in Registry.hpp).
+template <typename... Components, typename Func>
+void parallelEachInRegistry(Registry& registry, Func& func, size_t grainSize);
+
+/// @brief Forwards to `Registry::jobs` (defined in Registry.hpp).
+JobSystem& jobsInRegistry(Registry& registry);
+
+/// @brief Forwards to `Registry::iterationStamp` (defined in Registry.hpp).
+template <typename Component>
+uint64_t iterationStampInRegistry(
+    const Registry& registry, const ComponentPool<Component>* pool);
+
+/**
+ * @struct IterationStamp
+ * @brief Tick an iteration stamps `Component` with, so that a tuple of them
+ * can be indexed by component type.
+ */
+template <typename Component>
+struct IterationStamp
+{
+    uint64_t tick = 0;  ///< See `Registry::iterationStamp`.
+};
+
+/// @brief Forwards to `Registry::signature` (defined in Registry.hpp).
+const ComponentSignature& signatureInRegistry(
+    const Registry& registry, EntityManager::Entity e);
+
+/**
+ * @struct Observe
+ * @brief Type list of components a group reads without owning them.
+ */
+template <typename... Components>
+struct Observe
+{
+};
+
+/// @brief Tag value used to pass observed components to `Registry::group`.
+template <typename... Components>
+inline constexpr Observe<Components...> observe{};
+
+/**
+ * @class IGroup
+ * @brief Type-erased interface the `Registry` uses to keep groups up to date.
+ */
+class IGroup
+{
+   public:
+    using Entity = EntityManager::Entity;
+
+    virtual ~IGroup() = default;
+
+    /// @brief Called after `e` gained one of the group's components, once
+    /// its signature matches().
+    virtual void onEmplace(Entity e) = 0;
+
+    /// @brief Called before `e` loses one of the group's components.
+    virtual void onRemove(Entity e) = 0;
+
+    /// @brief Returns the number of members packed at the front of the
+    /// owned pools (0 for a group forwarding to each()).
+    virtual size_t packed() const = 0;
+
+    /// @brief Swaps two member positions in every owned pool at once.
+    virtual void swapMembers(size_t lhs, size_t rhs) = 0;
+
+    /// @brief Checks that an entity signature holds every group component.
+    bool matches(const ComponentSignature& signature) const
+    {
+        const ComponentSignature required = owned | observed;
+        return (signature & required) == required;
+    }
+
+    /// @brief Component types owned (kept packed) by this group.
+    ComponentSignature owned;
+
+    /// @brief Component types only read by this group.
+    ComponentSignature observed;
+};
+
+template <typename OwnedList, typename ObservedList>
+class Group;
+
+/**
+ * @class Group
+ * @brief Persistent set of the entities holding a fixed list of components.
+ *
+ * A group **owns** one or more pools: their members are packed at the front
+ * of each owned pool, in the same order. Iterating a group is therefore a
+ * linear walk over the owned arrays, with no per-entity membership probe.
+ * Observed components are fetched through their sparse index.
+ *
+ * Membership is maintained incrementally by the `Registry` on emplace, remove
+ * and destroy, so the set never needs to be rebuilt. A pool can be owned by a
+ * single group only.
+ *
+ * When one of the components is archetype-stored there is no pool to pack:
+ * the group then simply forwards to `Registry::each`, which already walks
+ * contiguous chunks.
+ *
+ * @tparam Owned Component types whose pools are kept packed.
+ * @tparam Observed Component types that members must also have.
+ */
+template <typename... Owned, typename... Observed>
+class Group<std::tuple<Owned...>, std::tuple<Observed...>> : public IGroup
+{
+    static_assert(sizeof...(Owned) > 0, "A group must own at least one pool");
+
+   public:
+    Group(Registry& registry, ComponentPool<Owned>&... ownedPools,
+          ComponentPool<Observed>&... observedPools)
+        : owning(&ownedPools...), observing(&observedPools...),
+          registry(&registry)
+    {
+    }
+
+    /**
+     * @brief Builds a group that forwards to `registry` instead of packing
+     * pools, used when a component is archetype-stored.
+     */
+    explicit Group(Registry& registry)
+        : owning(static_cast<ComponentPool<Owned>*>(nullptr)...),
+          observing(static_cast<ComponentPool<Observed>*>(nullptr)...),
+          registry(&registry), forward(true)
+    {
+    }
+
+    void onEmplace(Entity e) override
+    {
+        if (contains(e))
+            return;
+
+        std::apply(
+            [&](auto*... pools) {
+                (pools->storage.swapAt(pools->storage.index(e), length), ...);
+            },
+            owning);
+        length++;
+    }
+
+    void onRemove(Entity e) override
+    {
+        if (!contains(e))
+            return;
+
+        length--;
+        std::apply(
+            [&](auto*... pools) {
+                (pools->storage.swapAt(pools->storage.index(e), length), ...);
+            },
+            owning);
+    }
+
+    size_t packed() const override
+    {
+        return length;
+    }
+
+    void swapMembers(size_t lhs, size_t rhs) override
+    {
+        std::apply(
+            [&](auto*... pools) { (pools->storage.swapAt(lhs, rhs), ...); },
+            owning);
+    }
+
+    /**
+     * @brief Checks whether `e` currently belongs to the group.
+     */
+    bool contains(Entity e) const
+    {
+        if (forward)
+            return matches(signatureInRegistry(*registry, e));
+
+        const auto& lead = std::get<0>(owning)->storage;
+        return lead.contains(e) && lead.index(e) < length;
+    }
+
+    /// @brief Returns the number of entities in the group.
+    size_t size() const
+    {
+        if (forward) {
+            size_t members = 0;
+            auto counter = [&members](Entity, Owned&..., Observed&...) {
+                members++;
+            };
+            eachInRegistry<Owned..., Observed...>(*registry, counter);
+            return members;
+        }
+        return length;
+    }
+
+    /// @brief Checks if the group has no members.
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Calls `func(Entity, Owned&..., Observed&...)` for every member.
+     *
+     * Members are visited from the back, so destroying the current entity
+     * or adding new members from within `func` is safe.
+     */
+    template <typename Func>
+    void each(Func&& func)
+    {
+        if (forward) {
+            eachInRegistry<Owned..., Observed...>(*registry, func);
+            return;
+        }
+
+        const auto stamps = iterationStamps();
+
+        ECS_PROFILE_ENTITIES(length);
+        for (size_t i = length; i-- > 0;) {
+            if (i >= length)
+                continue;
+
+            const Entity e = std::get<0>(owning)->storage.begin()[i];
+            func(e,
+                 std::get<ComponentPool<Owned>*>(owning)->storage.visitAt(
+                     i, std::get<IterationStamp<Owned>>(stamps).tick)...,
+                 std::get<ComponentPool<Observed>*>(observing)->storage.visit(
+                     e, std::get<IterationStamp<Observed>>(stamps).tick)...);
+        }
+    }
+
+    /**
+     * @brief each() split across the registry's job system, `grainSize`
+     * members per job.
+     *
+     * Same rules as `Registry::parallelEach`: `func` runs concurrently and
+     * must record structural changes through `Registry::commands()`.
+     */
+    template <typename Func>
+    void parallelEach(
+        Func&& func, size_t grainSize = JobSystem::DEFAULT_GRAIN_SIZE)
+    {
+        if (forward) {
+            parallelEachInRegistry<Owned..., Observed...>(
+                *registry, func, grainSize);
+            return;
+        }
+
+        const auto stamps = iterationStamps();
+
+        ECS_PROFILE_ENTITIES(length);
+        jobsInRegistry(*registry).parallelFor(
+            length, grainSize, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const Entity e = std::get<0>(owning)->storage.begin()[i];
+                    func(e,
+                         std::get<ComponentPool<Owned>*>(owning)
+                             ->storage.visitAt(
+                                 i,
+                                 std::get<IterationStamp<Owned>>(stamps)
+                                     .tick)...,
+                         std::get<ComponentPool<Observed>*>(observing)
+                             ->storage.visit(
+                                 e, std::get<IterationStamp<Observed>>(stamps)
+                                        .tick)...);
+                }
+            });
+    }
+
+   private:
+    /// @brief Resolves the iteration stamp of every pool, on the calling
+    /// thread (see `Registry::iterationStamp`).
+    std::tuple<IterationStamp<Owned>..., IterationStamp<Observed>...>
+    iterationStamps() const
+    {
+        return {
+            IterationStamp<Owned>{iterationStampInRegistry(
+                *registry, std::get<ComponentPool<Owned>*>(owning))}...,
+            IterationStamp<Observed>{iterationStampInRegistry(
+                *registry, std::get<ComponentPool<Observed>*>(observing))}...};
+    }
+
+    std::tuple<ComponentPool<Owned>*...> owning;  ///< Pools kept packed.
+    std::tuple<ComponentPool<Observed>*...> observing;  ///< Pools probed, not reordered.
+    size_t length = 0;  ///< Members occupy [0, length) of each owned pool.
+    Registry* registry;  ///< Registry that created the group.
+    bool forward = false;  ///< Set when iteration goes through each().
+};
@@ -0,0 +1,309 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @class JobSystem
+ * @brief Work-stealing pool running the engine's jobs.
+ *
+ * Every worker owns a deque: it pushes and pops its own jobs at the back
+ * (most recent first, still hot in cache) and, once empty, steals the
+ * oldest job at the front of another deque. Threads outside the pool share
+ * one extra deque.
+ *
+ * Jobs are submitted against a `Counter`, and wait() returns once every job
+ * of that counter has finished. The waiting thread runs pending jobs
+ * meanwhile, so jobs may themselves submit and wait for jobs (e.g. a
+ * parallelFor() inside a system running on a worker) without deadlocking,
+ * and a pool with no worker runs everything on the caller.
+ */
+class JobSystem
+{
+   public:
+    /**
+     * @class Counter
+     * @brief Number of unfinished jobs of a batch, plus its first exception.
+     */
+    class Counter
+    {
+       public:
+        /// @brief Checks whether every job of the batch has finished.
+        bool done() const
+        {
+            return pending.load(std::memory_order_acquire) == 0;
+        }
+
+       private:
+        friend class JobSystem;
+
+        std::atomic<size_t> pending{0};  ///< Jobs not finished yet.
+        std::mutex errorMutex;  ///< Guards `error`.
+        std::exception_ptr error;  ///< First exception thrown by a job.
+    };
+
+    /**
+     * @brief Starts `workers` threads.
+     * @param workers Number of threads besides the ones calling wait().
+     */
+    explicit JobSystem(size_t workers)
+    {
+        for (size_t i = 0; i <= workers; ++i) {
+            queues.push_back(std::make_unique<Queue>());
+        }
+        threads.reserve(workers);
+        for (size_t i = 0; i < workers; ++i) {
+            threads.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /// @brief Lets the workers finish the queued jobs, then joins them.
+    ~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /// @brief Default number of items per job of a parallel loop.
+    static constexpr size_t DEFAULT_GRAIN_SIZE = 1024;
+
+    /// @brief Returns the number of worker threads.
+    size_t size() const
+    {
+        return threads.size();
+    }
+
+    /**
+     * @brief Queues `job` on the calling thread's deque.
+     * @param counter Batch the job belongs to; must outlive the job.
+     */
+    void submit(Counter& counter, std::function<void()> job)
+    {
+        counter.pending.fetch_add(1, std::memory_order_relaxed);
+        queued.fetch_add(1, std::memory_order_release);
+
+        Queue& queue = *queues[currentQueue()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back(Job{std::move(job), &counter});
+        }
+
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wake.notify_one();
+    }
+
+    /**
+     * @brief Runs pending jobs until every job of `counter` has finished.
+     * @throws The first exception thrown by one of those jobs.
+     */
+    void wait(Counter& counter)
+    {
+        const size_t self = currentQueue();
+
+        while (!counter.done()) {
+            if (runOne(self)) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wake.wait(lock, [&] {
+                return counter.done() ||
+                       queued.load(std::memory_order_acquire) > 0;
+            });
+        }
+
+        std::exception_ptr thrown;
+        {
+            std::lock_guard<std::mutex> lock(counter.errorMutex);
+            thrown = std::exchange(counter.error, nullptr);
+        }
+        if (thrown) {
+            std::rethrow_exception(thrown);
+        }
+    }
+
+    /**
+     * @brief Calls `func(begin, end)` over [0, count) split into ranges of
+     * `grainSize`, and returns once all of them are done.
+     *
+     * The first range runs on the caller; a single range never leaves it.
+     * If several ranges throw, the first exception seen is rethrown.
+     */
+    template <typename Func>
+    void parallelFor(size_t count, size_t grainSize, Func&& func)
+    {
+        grainSize = std::max<size_t>(grainSize, 1);
+        if (count <= grainSize || threads.empty()) {
+            if (count > 0) {
+                func(size_t{0}, count);
+            }
+            return;
+        }
+
+        struct Range
+        {
+            Func* func;
+            size_t count;
+            size_t grainSize;
+
+            void operator()(size_t begin) const
+            {
+                (*func)(begin, std::min(count, begin + grainSize));
+            }
+        } range{&func, count, grainSize};
+
+        Counter counter;
+        for (size_t begin = grainSize; begin < count; begin += grainSize) {
+            submit(counter, [&range, begin] { range(begin); });
+        }
+
+        std::exception_ptr thrown;
+        try {
+            range(0);
+        } catch (...) {
+            thrown = std::current_exception();
+        }
+        try {
+            wait(counter);
+        } catch (...) {
+            if (!thrown) {
+                thrown = std::current_exception();
+            }
+        }
+        if (thrown) {
+            std::rethrow_exception(thrown);
+        }
+    }
+
+   private:
+    struct Job
+    {
+        std::function<void()> run;  ///< Work to do.
+        Counter* counter = nullptr;  ///< Batch notified when `run` returns.
+    };
+
+    struct Queue
+    {
+        std::mutex mutex;  ///< Guards `jobs`.
+        std::deque<Job> jobs;  ///< Owner side at the back.
+    };
+
+    /// @brief Identifies the worker running on the current thread, if any.
+    struct WorkerSlot
+    {
+        const JobSystem* system = nullptr;
+        size_t index = 0;
+    };
+
+    static WorkerSlot& workerSlot()
+    {
+        thread_local WorkerSlot slot;
+        return slot;
+    }
+
+    /// @brief Returns the deque of the calling worker, or the shared one.
+    size_t currentQueue() const
+    {
+        const WorkerSlot& slot = workerSlot();
+        return slot.system == this ? slot.index : threads.size();
+    }
+
+    /**
+     * @brief Pops a job from the back of deque `self`, or steals one from
+     * the front of another deque, and runs it.
+     * @return False if every deque was empty.
+     */
+    bool runOne(size_t self)
+    {
+        Job job;
+        bool found = popBack(*queues[self], job);
+        for (size_t i = 1; !found && i < queues.size(); ++i) {
+            found = popFront(*queues[(self + i) % queues.size()], job);
+        }
+        if (!found) {
+            return false;
+        }
+        queued.fetch_sub(1, std::memory_order_relaxed);
+
+        try {
+            job.run();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(job.counter->errorMutex);
+            if (!job.counter->error) {
+                job.counter->error = std::current_exception();
+            }
+        }
+
+        if (job.counter->pending.fetch_sub(1, std::memory_order_acq_rel) ==
+            1) {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            wake.notify_all();
+        }
+        return true;
+    }
+
+    static bool popBack(Queue& queue, Job& job)
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty()) {
+            return false;
+        }
+        job = std::move(queue.jobs.back());
+        queue.jobs.pop_back();
+        return true;
+    }
+
+    static bool popFront(Queue& queue, Job& job)
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty()) {
+            return false;
+        }
+        job = std::move(queue.jobs.front());
+        queue.jobs.pop_front();
+        return true;
+    }
+
+    void workerLoop(size_t index)
+    {
+        workerSlot() = WorkerSlot{this, index};
+
+        while (true) {
+            if (runOne(index)) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wake.wait(lock, [this] {
+                return stopping || queued.load(std::memory_order_acquire) > 0;
+            });
+            if (stopping && queued.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues;  ///< One per worker + shared.
+    std::vector<std::thread> threads;  ///< Worker threads.
+    std::atomic<size_t> queued{0};  ///< Jobs sitting in a deque.
+
+    std::mutex sleepMutex;  ///< Guards `stopping` and idle waits.
+    std::condition_variable wake;  ///< Signals new jobs and finished batches.
+    bool stopping = false;  ///< Set by the destructor.
+};
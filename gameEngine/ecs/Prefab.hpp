@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "CommandBuffer.hpp"
+#include "ComponentRegistry.hpp"
+#include "EntityManager.hpp"
+#include "Types.hpp"
+
+class Registry;
+
+/**
+ * @class Prefab
+ * @brief Blueprint of an entity: a fixed component set with default values.
+ *
+ * Built once with with(), then instantiated as often as needed through
+ * `Registry::spawn` or `CommandBuffer::spawn`, which copy the defaults
+ * instead of rebuilding every component (and its vectors or strings) at each
+ * spawn site.
+ *
+ * Per-instance values are given by emplacing the component in the init
+ * callback of spawn(): it runs before the defaults are copied, and an entity
+ * keeps the first component emplaced for a type.
+ *
+ * @code
+ * Prefab bullet;
+ * bullet.with<Velocity>(1000.0f).with<Damage>(1).with<Health>(1, 1);
+ *
+ * registry.spawn(bullet, [&](Entity e) {
+ *     registry.emplace<Position>(e, x, y);
+ * });
+ * @endcode
+ */
+class Prefab
+{
+   public:
+    using Entity = EntityManager::Entity;
+
+    Prefab() = default;
+    Prefab(Prefab&&) = default;
+    Prefab& operator=(Prefab&&) = default;
+
+    /**
+     * @brief Sets the default `Component`, replacing the previous one.
+     * @param args Arguments forwarded to the component constructor.
+     * @return This prefab, to chain calls.
+     */
+    template <typename Component, typename... Args>
+    Prefab& with(Args&&... args)
+    {
+        const ComponentID id = ComponentRegistry::typeID<Component>();
+        auto entry = std::make_unique<Entry<Component>>(
+            id, std::forward<Args>(args)...);
+
+        auto it = std::find_if(
+            entries.begin(), entries.end(),
+            [id](const auto& existing) { return existing->id == id; });
+        if (it != entries.end()) {
+            *it = std::move(entry);
+        } else {
+            entries.push_back(std::move(entry));
+        }
+        components.set(id);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the default `Component`, to adjust it in place.
+     * @warning The prefab must hold a `Component` (see has()).
+     */
+    template <typename Component>
+    Component& get()
+    {
+        const ComponentID id = ComponentRegistry::typeID<Component>();
+        for (auto& entry : entries) {
+            if (entry->id == id) {
+                return static_cast<Entry<Component>*>(entry.get())->value;
+            }
+        }
+        throw std::out_of_range("[Prefab] Component not in the prefab");
+    }
+
+    /// @brief Checks whether the prefab holds a `Component`.
+    template <typename Component>
+    bool has() const
+    {
+        return components.test(ComponentRegistry::typeID<Component>());
+    }
+
+    /// @brief Returns the component types of the instances.
+    const ComponentSignature& signature() const
+    {
+        return components;
+    }
+
+    /// @brief Returns the number of component types of the instances.
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+   private:
+    friend class Registry;
+    friend class CommandBuffer;
+
+    /**
+     * @struct IEntry
+     * @brief Type-erased default component.
+     */
+    struct IEntry
+    {
+        explicit IEntry(ComponentID id) : id(id) {}
+        virtual ~IEntry() = default;
+
+        /// @brief Grows the pool of the component by `count` instances.
+        virtual void reserve(Registry& registry, size_t count) const = 0;
+
+        /// @brief Copies the default into `e`, unless it already has one.
+        virtual void emplace(Registry& registry, Entity e) const = 0;
+
+        /// @brief Records a copy of the default for `e` in `commands`.
+        virtual void record(CommandBuffer& commands, Entity e) const = 0;
+
+        ComponentID id;  ///< Type of the component.
+    };
+
+    /**
+     * @struct Entry
+     * @brief Default value of one component type.
+     *
+     * reserve() and emplace() are defined in Registry.hpp, once `Registry`
+     * is complete.
+     */
+    template <typename Component>
+    struct Entry : IEntry
+    {
+        template <typename... Args>
+        explicit Entry(ComponentID id, Args&&... args)
+            : IEntry(id), value(std::forward<Args>(args)...)
+        {
+        }
+
+        void reserve(Registry& registry, size_t count) const override;
+        void emplace(Registry& registry, Entity e) const override;
+
+        void record(CommandBuffer& commands, Entity e) const override
+        {
+            commands.emplace<Component>(e, value);
+        }
+
+        Component value;  ///< Copied into every instance.
+    };
+
+    std::vector<std::unique_ptr<IEntry>> entries;  ///< In insertion order.
+    ComponentSignature components;  ///< Types held by `entries`.
+};
+
+inline CommandBuffer::Entity CommandBuffer::spawn(const Prefab& prefab)
+{
+    return spawn(prefab, [](Entity) {});
+}
+
+template <typename Init>
+CommandBuffer::Entity CommandBuffer::spawn(const Prefab& prefab, Init&& init)
+{
+    const Entity e = create();
+    init(e);
+    for (const auto& entry : prefab.entries) {
+        entry->record(*this, e);
+    }
+    return e;
+}
@@ -0,0 +1,448 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <new>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "System.hpp"
+#include "Types.hpp"
+
+#ifndef ECS_DISABLE_PROFILER
+    #define ECS_PROFILE_ENTITIES(count) Profiler::countEntities(count)
+#else
+    #define ECS_PROFILE_ENTITIES(count) do {} while(0)
+#endif
+
+/**
+ * @brief Replaces the global operator new/delete so that the `Profiler`
+ * counts heap allocations.
+ *
+ * Expand it once, at namespace scope, in one source file of the program.
+ * Expands to nothing when `ECS_DISABLE_PROFILER` is defined.
+ */
+#ifndef ECS_DISABLE_PROFILER
+    #define ECS_PROFILER_ALLOCATION_HOOKS()                           \
+        void* operator new(std::size_t size)                          \
+        {                                                             \
+            Profiler::countAllocation();                              \
+            if (void* memory = std::malloc(size ? size : 1))          \
+                return memory;                                        \
+            throw std::bad_alloc();                                   \
+        }                                                             \
+        void operator delete(void* memory) noexcept                   \
+        {                                                             \
+            std::free(memory);                                        \
+        }                                                             \
+        void operator delete(void* memory, std::size_t) noexcept      \
+        {                                                             \
+            std::free(memory);                                        \
+        }
+#else
+    #define ECS_PROFILER_ALLOCATION_HOOKS()
+#endif
+
+/**
+ * @struct ProfileStats
+ * @brief Rolling statistics of a system, or of the fixed step, over the
+ * last profiled ticks.
+ */
+struct ProfileStats
+{
+    size_t samples = 0;  ///< Number of ticks in the window.
+    double p50 = 0.0;  ///< Median duration, in milliseconds.
+    double p99 = 0.0;  ///< 99th percentile duration, in milliseconds.
+    double max = 0.0;  ///< Longest duration, in milliseconds.
+    double entities = 0.0;  ///< Mean number of entities walked per tick.
+    double allocations = 0.0;  ///< Mean number of heap allocations per tick.
+};
+
+/**
+ * @class Profiler
+ * @brief Optional instrumentation of the fixed steps run by the `Scheduler`.
+ *
+ * Once enable()d, every system call and every fixed step records its wall
+ * time, the number of entities walked by each(), parallelEach() and groups,
+ * and the number of heap allocations (counted only if the program expands
+ * ECS_PROFILER_ALLOCATION_HOOKS()). The last `window` samples of each feed
+ * the percentiles returned by systemStats() and stepStats(), and the ticks
+ * selected by captureTrace() can be written as a Chrome `trace_event` file
+ * (chrome://tracing, Perfetto).
+ *
+ * The counts of a system include what it does on other threads through
+ * parallelEach(). The counts of a step include the command buffer flushes.
+ *
+ * Defining `ECS_DISABLE_PROFILER` compiles every hook out: enable() then
+ * does nothing and no sample is ever recorded.
+ */
+class Profiler
+{
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Default number of ticks kept for the percentiles.
+    static constexpr size_t DEFAULT_WINDOW = 512;
+
+    /// @brief Work counted on one thread.
+    struct Counters
+    {
+        uint64_t entities = 0;  ///< Entities walked by iterations.
+        uint64_t allocations = 0;  ///< Heap allocations.
+
+        Counters operator-(const Counters& other) const
+        {
+            return {entities - other.entities, allocations - other.allocations};
+        }
+
+        Counters& operator+=(const Counters& other)
+        {
+            entities += other.entities;
+            allocations += other.allocations;
+            return *this;
+        }
+    };
+
+    /// @brief Adds `count` walked entities to the calling thread.
+    static void countEntities(size_t count)
+    {
+        local.entities += count;
+    }
+
+    /// @brief Adds one heap allocation to the calling thread.
+    static void countAllocation()
+    {
+        local.allocations++;
+    }
+
+    /// @brief Returns everything counted so far on the calling thread.
+    static Counters counters()
+    {
+        return local;
+    }
+
+    /// @brief Returns a small number identifying the calling thread.
+    static uint32_t threadIndex()
+    {
+        static std::atomic<uint32_t> nextIndex{0};
+        thread_local const uint32_t index = nextIndex++;
+        return index;
+    }
+
+    /**
+     * @brief Starts recording, keeping the last `window` ticks for the
+     * statistics.
+     *
+     * Clears the previous statistics. Must not be called during a step.
+     */
+    void enable(size_t window = DEFAULT_WINDOW)
+    {
+#ifndef ECS_DISABLE_PROFILER
+        windowSize = std::max<size_t>(window, 1);
+        series.clear();
+        step = Series();
+        epoch = Clock::now();
+        on = true;
+#else
+        (void)window;
+#endif
+    }
+
+    /// @brief Stops recording; statistics and trace stay readable.
+    void disable()
+    {
+        on = false;
+    }
+
+    /// @brief Checks whether steps are being recorded.
+    bool enabled() const
+    {
+        return on;
+    }
+
+    /**
+     * @brief Returns the statistics of system `id`, empty if it never ran
+     * while profiling.
+     */
+    ProfileStats systemStats(SystemID id) const
+    {
+        auto it = series.find(id);
+        return it != series.end() ? summarize(it->second) : ProfileStats();
+    }
+
+    /// @brief Returns the statistics of whole fixed steps.
+    ProfileStats stepStats() const
+    {
+        return summarize(step);
+    }
+
+    /**
+     * @brief Records trace events for the steps of ticks [firstTick,
+     * lastTick] (see `Registry::tick()`), dropping the ones captured before.
+     */
+    void captureTrace(uint64_t firstTick, uint64_t lastTick)
+    {
+        traceFirst = firstTick;
+        traceLast = lastTick;
+        events.clear();
+    }
+
+    /// @brief Returns the number of trace events captured.
+    size_t traceEventCount() const
+    {
+        return events.size();
+    }
+
+    /// @brief Writes the captured events as a Chrome `trace_event` JSON.
+    void writeChromeTrace(std::ostream& os) const
+    {
+        const std::ios_base::fmtflags flags = os.flags();
+        const std::streamsize precision = os.precision();
+        os << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+        for (size_t i = 0; i < events.size(); ++i) {
+            const TraceEvent& event = events[i];
+            os << (i ? ",\n" : "\n") << "{\"name\":\"";
+            writeEscaped(os, event.name);
+            os << "\",\"cat\":\"" << (event.isStep ? "step" : "system")
+               << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread
+               << ",\"ts\":" << event.start << ",\"dur\":" << event.duration
+               << ",\"args\":{\"tick\":" << event.tick
+               << ",\"entities\":" << event.counters.entities
+               << ",\"allocations\":" << event.counters.allocations << "}}";
+        }
+        os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        os.flags(flags);
+        os.precision(precision);
+    }
+
+    /**
+     * @brief Writes the captured events to the file at `path`.
+     * @return False if the file could not be written.
+     */
+    bool writeChromeTrace(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (!file)
+            return false;
+        writeChromeTrace(file);
+        return static_cast<bool>(file);
+    }
+
+    /**
+     * @brief Opens the step of `tick` over `systems` scheduled systems.
+     * Called by the `Scheduler`.
+     */
+    void beginStep(uint64_t tick, size_t systems, Clock::time_point start)
+    {
+        active = on;
+        if (!active)
+            return;
+
+        stepTick = tick;
+        stepStart = start;
+        stepThread = threadIndex();
+        stepBefore = counters();
+        pending.assign(systems, SystemSample());
+    }
+
+    /**
+     * @brief Records the call of the `slot`-th scheduled system; calls for
+     * distinct slots may come from several threads at once.
+     */
+    void recordSystem(
+        size_t slot, Clock::time_point start, Clock::time_point end,
+        const Counters& work)
+    {
+        if (!active)
+            return;
+
+        SystemSample& sample = pending[slot];
+        sample.start = start;
+        sample.end = end;
+        sample.counters = work;
+        sample.thread = threadIndex();
+        sample.ran = true;
+    }
+
+    /**
+     * @brief Closes the step opened by beginStep() and folds its samples
+     * into the statistics and the trace.
+     * @param scheduled The systems of the step, by slot.
+     */
+    void endStep(const std::vector<ISystem*>& scheduled, Clock::time_point end)
+    {
+        if (!active)
+            return;
+        active = false;
+
+        Counters total = counters() - stepBefore;
+        for (size_t i = 0; i < pending.size(); ++i) {
+            if (pending[i].ran && pending[i].thread != stepThread) {
+                total += pending[i].counters;
+            }
+        }
+
+        const bool tracing = stepTick >= traceFirst && stepTick <= traceLast;
+        for (size_t i = 0; i < pending.size(); ++i) {
+            const SystemSample& sample = pending[i];
+            if (!sample.ran)
+                continue;
+
+            Series& system = series[scheduled[i]->getSystemID()];
+            if (system.name.empty()) {
+                system.name = scheduled[i]->getName();
+            }
+            push(system, sample.start, sample.end, sample.counters);
+            if (tracing) {
+                trace(system.name, false, sample.thread, sample.start,
+                      sample.end, sample.counters);
+            }
+        }
+
+        push(step, stepStart, end, total);
+        if (tracing) {
+            trace("step", true, stepThread, stepStart, end, total);
+        }
+    }
+
+   private:
+    /// @brief Call of one system during the open step.
+    struct SystemSample
+    {
+        Clock::time_point start;
+        Clock::time_point end;
+        Counters counters;
+        uint32_t thread = 0;
+        bool ran = false;
+    };
+
+    /// @brief One tick in a rolling window.
+    struct Entry
+    {
+        double milliseconds;
+        Counters counters;
+    };
+
+    /// @brief Rolling window of a system or of the step.
+    struct Series
+    {
+        std::string name;  ///< Name of the system.
+        std::vector<Entry> entries;  ///< Ring buffer of the last ticks.
+        size_t next = 0;  ///< Slot overwritten by the next tick.
+    };
+
+    /// @brief Complete ("X") event of the Chrome trace.
+    struct TraceEvent
+    {
+        std::string name;
+        bool isStep;
+        uint32_t thread;
+        double start;  ///< Microseconds since enable().
+        double duration;  ///< Microseconds.
+        uint64_t tick;
+        Counters counters;
+    };
+
+    /// @brief Appends a tick to `target`, overwriting the oldest if full.
+    void push(
+        Series& target, Clock::time_point start, Clock::time_point end,
+        const Counters& work)
+    {
+        const Entry entry{
+            std::chrono::duration<double, std::milli>(end - start).count(),
+            work};
+        if (target.entries.size() < windowSize) {
+            target.entries.push_back(entry);
+        } else {
+            target.entries[target.next] = entry;
+        }
+        target.next = (target.next + 1) % windowSize;
+    }
+
+    /// @brief Appends a trace event.
+    void trace(
+        const std::string& name, bool isStep, uint32_t thread,
+        Clock::time_point start, Clock::time_point end, const Counters& work)
+    {
+        using Micro = std::chrono::duration<double, std::micro>;
+        events.push_back(
+            {name, isStep, thread, Micro(start - epoch).count(),
+             Micro(end - start).count(), stepTick, work});
+    }
+
+    /// @brief Computes the statistics of a window.
+    static ProfileStats summarize(const Series& source)
+    {
+        ProfileStats stats;
+        stats.samples = source.entries.size();
+        if (stats.samples == 0)
+            return stats;
+
+        std::vector<double> durations;
+        durations.reserve(stats.samples);
+        for (const Entry& entry : source.entries) {
+            durations.push_back(entry.milliseconds);
+            stats.entities += static_cast<double>(entry.counters.entities);
+            stats.allocations +=
+                static_cast<double>(entry.counters.allocations);
+        }
+        std::sort(durations.begin(), durations.end());
+
+        stats.p50 = percentile(durations, 0.50);
+        stats.p99 = percentile(durations, 0.99);
+        stats.max = durations.back();
+        stats.entities /= static_cast<double>(stats.samples);
+        stats.allocations /= static_cast<double>(stats.samples);
+        return stats;
+    }
+
+    /// @brief Nearest-rank percentile `q` of the sorted `values`.
+    static double percentile(const std::vector<double>& values, double q)
+    {
+        const double count = static_cast<double>(values.size());
+        const size_t rank = static_cast<size_t>(std::ceil(q * count));
+        return values[std::min(std::max<size_t>(rank, 1), values.size()) - 1];
+    }
+
+    /// @brief Writes `text` as the content of a JSON string.
+    static void writeEscaped(std::ostream& os, const std::string& text)
+    {
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                os << '\\' << c;
+            } else if (static_cast<unsigned char>(c) >= 0x20) {
+                os << c;
+            }
+        }
+    }
+
+    static thread_local Counters local;  ///< Counts of this thread.
+
+    bool on = false;  ///< Set by enable().
+    bool active = false;  ///< Whether the current step is recorded.
+    size_t windowSize = DEFAULT_WINDOW;  ///< Ticks kept per series.
+    Clock::time_point epoch;  ///< Origin of the trace timestamps.
+
+    uint64_t stepTick = 0;  ///< Tick of the open step.
+    Clock::time_point stepStart;  ///< Start of the open step.
+    uint32_t stepThread = 0;  ///< Thread running the open step.
+    Counters stepBefore;  ///< Counters of that thread at beginStep().
+    std::vector<SystemSample> pending;  ///< Calls of the open step, by slot.
+
+    std::unordered_map<SystemID, Series> series;  ///< Window of each system.
+    Series step;  ///< Window of whole steps.
+
+    uint64_t traceFirst = 1;  ///< First tick captured by the trace.
+    uint64_t traceLast = 0;  ///< Last tick captured by the trace.
+    std::vector<TraceEvent> events;  ///< Captured trace events.
+};
+
+inline thread_local Profiler::Counters Profiler::local;
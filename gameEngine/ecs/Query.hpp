@@ -0,0 +1,29 @@
+#pragma once
+
+/**
+ * @struct Exclude
+ * @brief Type list of components an entity must not have to be visited by
+ * `Registry::each`.
+ */
+template <typename... Components>
+struct Exclude
+{
+};
+
+/// @brief Tag value used to pass excluded components to `Registry::each`.
+template <typename... Components>
+inline constexpr Exclude<Components...> exclude{};
+
+/**
+ * @struct Optional
+ * @brief Type list of components `Registry::each` hands out as pointers,
+ * null when the entity does not have them.
+ */
+template <typename... Components>
+struct Optional
+{
+};
+
+/// @brief Tag value used to pass optional components to `Registry::each`.
+template <typename... Components>
+inline constexpr Optional<Components...> optional{};
@@ -1,13 +1,37 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "ArchetypeStorage.hpp"
 #include "Clock.hpp"
+#include "CommandBuffer.hpp"
+#include "ComponentPool.hpp"
 #include "ComponentRegistry.hpp"
 #include "EntityManager.hpp"
+#include "Events.hpp"
+#include "FrameArena.hpp"
+#include "Group.hpp"
+#include "JobSystem.hpp"
+#include "Prefab.hpp"
+#include "Profiler.hpp"
+#include "Query.hpp"
+#include "Resources.hpp"
+#include "Scheduler.hpp"
+#include "Signal.hpp"
 #include "SparseSet.hpp"
 #include "System.hpp"
 #include "Types.hpp"
@@ -23,18 +47,48 @@
  *
  * Components are stored in pools (SparseSets), while systems are dynamically
  * added and updated.
+ *
+ * Components can alternatively be stored in chunked archetypes (see
+ * `ArchetypeStorage`), either for the whole registry through the constructor
+ * or per type by specializing `ComponentStorage`. The public API is the same
+ * for both backends; only view() requires a SparseSet-backed type.
+ *
+ * Systems that declare their component access (see `SystemAccess`) are run
+ * concurrently with the systems they do not conflict with; the result is the
+ * same as updating them one by one in priority order.
+ *
+ * Each component type has lifecycle signals (onConstruct(), onUpdate(),
+ * onDestroy()), so reactions to an event cost O(events) instead of a scan of
+ * every entity each tick. A type nobody listens to only pays a bit test.
+ *
+ * Pools are iterated in dense order, which insertions and removals shuffle
+ * over time. sort() and sort<To, From>() restore an order in which joined
+ * iterations read every pool linearly; sortIncrementally() maintains it
+ * within a time budget per fixed step.
  */
 class Registry
 {
    public:
     using Entity = EntityManager::Entity;
 
+    /// @brief Lifecycle signal of a component type, see onConstruct().
+    using ComponentSignal = Signal<Registry&, Entity>;
+
     /**
      * @brief Constructs the registry, preparing internal storage.
+     * @param defaultStorage Backend of the component types whose
+     * `ComponentStorage` mode is `StorageMode::Default`.
+     * @param poolResource Memory resource of the SparseSet pools; must
+     * outlive the registry.
      */
-    Registry()
+    explicit Registry(
+        StorageMode defaultStorage = StorageMode::SparseSet,
+        std::pmr::memory_resource* poolResource =
+            std::pmr::get_default_resource())
+        : defaultStorage(defaultStorage), poolResource(poolResource)
     {
         componentPools.reserve(MAX_COMPONENTS);
+        componentSignals.reserve(MAX_COMPONENTS);
         systems.reserve(32);
         updateSystemAvailability();
     }
@@ -48,17 +102,99 @@ class Registry
         return entityManager.create();
     }
 
+    /**
+     * @brief Creates an entity holding a copy of every component of
+     * `prefab`.
+     * @return The new entity ID.
+     */
+    Entity spawn(const Prefab& prefab)
+    {
+        return spawn(prefab, [](Entity) {});
+    }
+
+    /**
+     * @brief spawn() calling `init(Entity)` before copying the defaults:
+     * components it emplaces replace those of `prefab`.
+     */
+    template <typename Init>
+    Entity spawn(const Prefab& prefab, Init&& init)
+    {
+        const Entity e = create();
+        init(e);
+        for (const auto& entry : prefab.entries) {
+            entry->emplace(*this, e);
+        }
+        return e;
+    }
+
+    /**
+     * @brief Creates `count` instances of `prefab`.
+     *
+     * Every pool of the prefab is grown once for the whole batch, then the
+     * instances are appended one after the other, so they end up contiguous
+     * in each pool.
+     *
+     * @param init Called as `init(Entity, size_t index)` for each instance
+     * before its defaults are copied; components it emplaces replace those
+     * of `prefab`.
+     */
+    template <typename Init>
+    void spawn(const Prefab& prefab, size_t count, Init&& init)
+    {
+        for (const auto& entry : prefab.entries) {
+            entry->reserve(*this, count);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const Entity e = create();
+            init(e, i);
+            for (const auto& entry : prefab.entries) {
+                entry->emplace(*this, e);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks whether `e` still refers to an alive entity.
+     *
+     * Handles carry a generation, so one kept across ticks (player slots,
+     * network IDs, deferred commands) stops being valid once its entity is
+     * destroyed, even after the slot is reused.
+     */
+    bool valid(Entity e) const
+    {
+        return entityManager.valid(e);
+    }
+
     /**
      * @brief Destroys an entity and removes all its components.
+     *
+     * Does nothing if `e` is no longer valid, so a destruction requested
+     * twice (e.g. from two command buffers) is harmless.
      * @param e Entity to destroy.
      */
     void destroy(Entity e)
     {
-        for (auto& pool : componentPools) {
-            if (pool) {
-                pool->remove(e);
+        if (!entityManager.valid(e))
+            return;
+
+        // Listeners still see the whole entity
+        const ComponentSignature observed =
+            entityManager.signature(e) & observedComponents;
+        forEachComponent(observed, [&](ComponentID id) {
+            componentSignals[id].destroy.publish(*this, e);
+        });
+
+        // Only visit the pools the entity actually uses
+        forEachComponent(entityManager.signature(e), [&](ComponentID id) {
+            if (archetypeComponents.test(id))
+                return;
+            IComponentPool* pool = componentPools[id].get();
+            for (IGroup* group : pool->groups) {
+                group->onRemove(e);
             }
-        }
+            pool->remove(e);
+        });
+        archetypes.destroy(e);
         entityManager.destroy(e);
     }
 
@@ -69,25 +205,52 @@ class Registry
      * @param e Target entity.
      * @param args Arguments forwarded to component constructor.
      * @return Reference to the newly emplaced component.
+     * @throws std::logic_error if `e` is no longer valid: its slot may
+     * already belong to another entity.
      */
     template <typename Component, typename... Args>
     Component& emplace(Entity e, Args&&... args)
     {
-        ComponentID id =
-            ComponentRegistry::instance().getOrCreateID<Component>();
+        if (!entityManager.valid(e)) {
+            throw std::logic_error(
+                "[Registry] emplace() requires a valid entity");
+        }
+
+        ComponentID id = ComponentRegistry::typeID<Component>();
+        if (storedInArchetypes<Component>(id)) {
+            return emplaceInArchetype<Component>(
+                e, id, std::forward<Args>(args)...);
+        }
+
         auto& pool = assurePool<Component>(id);
 
-        bool wasEmpty = pool.size() == 0;
+        const size_t previousSize = pool.size();
 
         pool.emplace(e, std::forward<Args>(args)...);
 
-        if (wasEmpty) {
+        if (pool.size() != previousSize) {
+            entityManager.addComponent(e, id);
+
+            // Groups may move the component while packing their members
+            const ComponentSignature& signature = entityManager.signature(e);
+            for (IGroup* group : pool.groups) {
+                if (group->matches(signature)) {
+                    group->onEmplace(e);
+                }
+            }
+        }
+
+        if (previousSize == 0) {
             ECS_LOG("[Registry] First component of type added, updating system availability\n");
             availableComponents.set(id);
             updateSystemAvailability();
         }
 
-        return pool.get(e);
+        if (pool.size() != previousSize && observedComponents.test(id)) {
+            componentSignals[id].construct.publish(*this, e);
+        }
+
+        return pool.storage.touch(e, currentTick);
     }
 
     /**
@@ -98,24 +261,7 @@ class Registry
     template <typename Component>
     void remove(Entity e)
     {
-        ComponentID id =
-            ComponentRegistry::instance().getOrCreateID<Component>();
-
-        if (id < componentPools.size() && componentPools[id]) {
-            auto* pool = static_cast<ComponentPool<Component>*>(
-                componentPools[id].get());
-
-            if (pool->contains(e)) {
-                pool->erase(e);
-
-                if (pool->size() == 0) {
-                    std::cout << "[Registry] Last component of type removed, "
-                                 "updating system availability\n";
-                    availableComponents.reset(id);
-                    updateSystemAvailability();
-                }
-            }
-        }
+        removeByID(ComponentRegistry::typeID<Component>(), e);
     }
 
     /**
@@ -127,20 +273,31 @@ class Registry
     template <typename Component>
     bool has(Entity e) const
     {
-        ComponentID id =
-            ComponentRegistry::instance().getOrCreateID<Component>();
-
-        if (id >= componentPools.size() || !componentPools[id])
-            return false;
+        return entityManager.signature(e).test(
+            ComponentRegistry::typeID<Component>());
+    }
 
-        auto* pool =
-            static_cast<ComponentPool<Component>*>(componentPools[id].get());
-        return pool->contains(e);
+    /**
+     * @brief Returns the set of component types attached to entity `e`.
+     *
+     * Can be matched against a system signature with
+     * `(signature & required) == required` without touching any pool.
+     */
+    const ComponentSignature& signature(Entity e) const
+    {
+        return entityManager.signature(e);
     }
 
     /**
      * @brief Gets a reference to a component of type `Component` for entity
      * `e`.
+     *
+     * If changes of `Component` are tracked, the component is stamped with
+     * the current tick; read through the const overload to avoid it.
+     *
+     * Does not compile for a tag component (see `isTagComponent`), which
+     * holds no data: test it with has().
+     *
      * @tparam Component Component type.
      * @param e Target entity.
      * @return Reference to the component.
@@ -148,11 +305,16 @@ class Registry
     template <typename Component>
     Component& get(Entity e)
     {
-        ComponentID id =
-            ComponentRegistry::instance().getOrCreateID<Component>();
+        static_assert(
+            !isTagComponent<Component>,
+            "Tag components hold no data, use has()");
+        ComponentID id = ComponentRegistry::typeID<Component>();
+        if (archetypeComponents.test(id)) {
+            return archetypes.get<Component>(e, id);
+        }
         auto* pool =
             static_cast<ComponentPool<Component>*>(componentPools[id].get());
-        return pool->get(e);
+        return pool->storage.touch(e, currentTick);
     }
 
     /**
@@ -161,8 +323,13 @@ class Registry
     template <typename Component>
     const Component& get(Entity e) const
     {
-        ComponentID id =
-            ComponentRegistry::instance().getOrCreateID<Component>();
+        static_assert(
+            !isTagComponent<Component>,
+            "Tag components hold no data, use has()");
+        ComponentID id = ComponentRegistry::typeID<Component>();
+        if (archetypeComponents.test(id)) {
+            return archetypes.get<Component>(e, id);
+        }
         auto* pool =
             static_cast<ComponentPool<Component>*>(componentPools[id].get());
         return pool->get(e);
@@ -171,18 +338,218 @@ class Registry
     /**
      * @brief Returns a reference to the SparseSet storing all components of
      * type `Component`.
+     *
+     * If changes of `Component` are tracked, every component of the pool is
+     * stamped with the current tick.
+     *
+     * @throws std::logic_error if `Component` is archetype-stored.
      */
     template <typename Component>
-    SparseSet<Entity, Component>& view()
+    typename ComponentPool<Component>::Storage& view()
     {
-        ComponentID id =
-            ComponentRegistry::instance().getOrCreateID<Component>();
-        return assurePool<Component>(id);
+        ComponentID id = ComponentRegistry::typeID<Component>();
+        if (storedInArchetypes<Component>(id)) {
+            throw std::logic_error(
+                "[Registry] view() requires a SparseSet-backed component");
+        }
+        auto& storage = assurePool<Component>(id).storage;
+        storage.touchAll(currentTick);
+        return storage;
+    }
+
+    /**
+     * @brief Starts recording, for every `Component`, the tick it was last
+     * written at.
+     *
+     * Writes are stamped by emplace(), the mutable get() and view(), and
+     * patch(). Iterations (each(), parallelEach(), groups) stamp what they
+     * hand out, except the components the running system declares it only
+     * reads (see iterationStamp()). Components already stored are stamped
+     * with the current tick.
+     *
+     * @throws std::logic_error if `Component` is archetype-stored.
+     */
+    template <typename Component>
+    void trackChanges()
+    {
+        ComponentID id = ComponentRegistry::typeID<Component>();
+        if (storedInArchetypes<Component>(id)) {
+            throw std::logic_error(
+                "[Registry] trackChanges() requires a SparseSet-backed "
+                "component");
+        }
+        assurePool<Component>(id).storage.enableChangeTracking(currentTick);
+    }
+
+    /// @brief Checks whether changes of `Component` are tracked.
+    template <typename Component>
+    bool tracksChanges() const
+    {
+        const auto* pool = findPool<Component>();
+        return pool && pool->storage.tracksChanges();
+    }
+
+    /**
+     * @brief Returns the tick an iteration stamps the components of `pool`
+     * with, or 0 if it leaves them unstamped.
+     *
+     * Iterations hand out mutable references, so a tracked component counts
+     * as written, unless the system updating on the calling thread declared
+     * its access without listing it in writeComponents().
+     */
+    template <typename Component>
+    uint64_t iterationStamp(const ComponentPool<Component>* pool) const
+    {
+        if (!pool || !pool->storage.tracksChanges())
+            return 0;
+
+        const SystemAccess* running = Scheduler::runningAccess();
+        if (running && running->declared &&
+            !running->writes.test(ComponentRegistry::typeID<Component>()))
+            return 0;
+        return currentTick;
+    }
+
+    /**
+     * @brief Calls `func(component)` on the `Component` of `e`, stamps it
+     * with the current tick and publishes onUpdate<Component>().
+     * @return Reference to the component.
+     */
+    template <typename Component, typename Func>
+    Component& patch(Entity e, Func&& func)
+    {
+        Component& component = get<Component>(e);
+        func(component);
+
+        const ComponentID id = ComponentRegistry::typeID<Component>();
+        if (observedComponents.test(id)) {
+            componentSignals[id].update.publish(*this, e);
+        }
+        return component;
+    }
+
+    /**
+     * @brief Signal published once a `Component` is added to an entity, by
+     * emplace() or a command buffer flush.
+     *
+     * Listeners receive the registry and the entity, and run on the thread
+     * that made the change, in the middle of it: they may read any
+     * component, but structural changes must go through commands().
+     *
+     * The change is made by a system writing `Component` (or outside
+     * update()), and the scheduler never runs it concurrently with a system
+     * that requires or reads `Component`. A listener may therefore queue the
+     * entity into state owned by such a system, without a lock, and let its
+     * onUpdate() handle it.
+     *
+     * Connecting stays valid across clear(); clear() publishes nothing.
+     */
+    template <typename Component>
+    ComponentSignal& onConstruct()
+    {
+        return signalsOf(ComponentRegistry::typeID<Component>()).construct;
+    }
+
+    /**
+     * @brief Signal published by patch() after `Component` was modified.
+     *
+     * Writes through get(), view() or iterations are not published, so a
+     * type with update listeners must be written through patch(). See
+     * onConstruct() for what listeners may do.
+     */
+    template <typename Component>
+    ComponentSignal& onUpdate()
+    {
+        return signalsOf(ComponentRegistry::typeID<Component>()).update;
+    }
+
+    /**
+     * @brief Signal published before a `Component` is removed, by remove()
+     * or destroy(); the component is still readable. See onConstruct() for
+     * what listeners may do.
+     */
+    template <typename Component>
+    ComponentSignal& onDestroy()
+    {
+        return signalsOf(ComponentRegistry::typeID<Component>()).destroy;
+    }
+
+    /**
+     * @brief Returns the tick the `Component` of `e` was last written at, or
+     * 0 if it is not tracked or `e` does not have it.
+     */
+    template <typename Component>
+    uint64_t changedAt(Entity e) const
+    {
+        const auto* pool = findPool<Component>();
+        if (!pool || !pool->storage.contains(e))
+            return 0;
+        return pool->storage.changedAt(e);
+    }
+
+    /**
+     * @brief Calls `func(Entity, Component&)` for every `Component` written
+     * after tick `since`, without stamping it again.
+     *
+     * Nothing is visited if changes of `Component` are not tracked.
+     */
+    template <typename Component, typename Func>
+    void eachChanged(uint64_t since, Func&& func)
+    {
+        auto* pool = findPool<Component>();
+        if (!pool)
+            return;
+
+        auto& storage = pool->storage;
+        const auto& ticks = storage.changeTicks();
+        for (size_t i = ticks.size(); i-- > 0;) {
+            if (ticks[i] > since) {
+                func(storage.begin()[i], storage.elementAt(i));
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the entities whose `Component` was written after tick
+     * `since`.
+     */
+    template <typename Component>
+    std::vector<Entity> changed(uint64_t since)
+    {
+        std::vector<Entity> entities;
+        eachChanged<Component>(
+            since, [&entities](Entity e, Component&) { entities.push_back(e); });
+        return entities;
+    }
+
+    /**
+     * @brief Returns the tick writes are currently stamped with.
+     *
+     * During update(), the `GameClock::frameCount` of the running fixed step;
+     * between updates, the one of the next step. Passing the frameCount of a
+     * finished step to changed() thus returns everything written since.
+     */
+    uint64_t tick() const
+    {
+        return currentTick;
     }
 
     /**
      * @brief Iterates through all entities that have all the specified
      * components.
+     *
+     * The pools are resolved once per call and the smallest one drives the
+     * iteration; missing pools are never created, so iterating over a
+     * component type that was never emplaced is a no-op. For hot loops over
+     * a fixed component list, prefer group().
+     *
+     * If one of the components is archetype-stored, the matching archetypes
+     * are walked chunk by chunk instead, and SparseSet-backed components are
+     * fetched through their pool.
+     *
+     * Tag components (see `isTagComponent`) act as filters: `func` receives
+     * a shared instance of them.
+     *
      * @tparam Components Component types to include.
      * @tparam Func Callable with signature `void(Entity, Components&...)`.
      * @param func Function to execute for each matching entity.
@@ -190,34 +557,341 @@ class Registry
     template <typename... Components, typename Func>
     void each(Func&& func)
     {
-        IComponentPool* smallestPool = nullptr;
-        size_t smallestSize = SIZE_MAX;
+        std::tuple<ComponentPool<Components>*...> pools(
+            findPool<Components>()...);
 
-        (
-            (void)[&] {
-                ComponentID id =
-                    ComponentRegistry::instance().getOrCreateID<Components>();
-                assurePool<Components>(id);
+        if ((archetypeComponents.test(
+                 ComponentRegistry::typeID<Components>()) ||
+             ...)) {
+            eachInArchetypes<Components...>(
+                pools, func, std::index_sequence_for<Components...>{});
+            return;
+        }
 
-                if (id < componentPools.size() && componentPools[id]) {
-                    IComponentPool* pool = componentPools[id].get();
-                    if (pool->size() < smallestSize) {
-                        smallestSize = pool->size();
-                        smallestPool = pool;
-                    }
-                }
-            }(),
-            ...);
+        eachIn(pools, func, std::index_sequence_for<Components...>{});
+    }
+
+    /**
+     * @brief each() over the entities having none of `Excluded...`, which
+     * also receive `Optionals...` as pointers (null when missing).
+     *
+     * Still a single pass over the smallest included pool: exclusion costs
+     * one AND of the entity signature with a mask built once per call, and
+     * optional components are only fetched when the signature holds them.
+     *
+     * @code
+     * registry.each<Health>(
+     *     exclude<InputControlled>, optional<ScoreValue>,
+     *     [](Entity e, Health& health, ScoreValue* score) { ... });
+     * @endcode
+     *
+     * @tparam Components Component types to include.
+     * @tparam Func Callable with signature
+     * `void(Entity, Components&..., Optionals*...)`.
+     */
+    template <
+        typename... Components, typename... Excluded, typename... Optionals,
+        typename Func>
+    void each(Exclude<Excluded...>, Optional<Optionals...>, Func&& func)
+    {
+        static_assert(
+            sizeof...(Components) > 0,
+            "each() needs an included component to iterate over");
+
+        ComponentSignature excluded;
+        (excluded.set(ComponentRegistry::typeID<Excluded>()), ...);
+        std::tuple<ComponentPool<Optionals>*...> optionals(
+            findPool<Optionals>()...);
+        const std::tuple<IterationStamp<Optionals>...> stamps(
+            IterationStamp<Optionals>{iterationStamp(
+                std::get<ComponentPool<Optionals>*>(optionals))}...);
+
+        each<Components...>([&](Entity e, Components&... components) {
+            const ComponentSignature& signature = entityManager.signature(e);
+            if ((signature & excluded).any())
+                return;
+
+            func(
+                e, components...,
+                optionalOf<Optionals>(
+                    signature, std::get<ComponentPool<Optionals>*>(optionals),
+                    e, std::get<IterationStamp<Optionals>>(stamps).tick)...);
+        });
+    }
+
+    /// @brief each() over the entities having none of `Excluded...`.
+    template <typename... Components, typename... Excluded, typename Func>
+    void each(Exclude<Excluded...> excluded, Func&& func)
+    {
+        each<Components...>(excluded, Optional<>{}, std::forward<Func>(func));
+    }
+
+    /// @brief each() also handing out `Optionals...` as pointers.
+    template <typename... Components, typename... Optionals, typename Func>
+    void each(Optional<Optionals...> optionals, Func&& func)
+    {
+        each<Components...>(Exclude<>{}, optionals, std::forward<Func>(func));
+    }
+
+    /**
+     * @brief each() split across the job system.
+     *
+     * The dense array of the smallest pool is cut into ranges of
+     * `grainSize` entities, one job each; archetype-stored components are
+     * split chunk by chunk. Returns once every entity has been visited.
+     *
+     * `func` runs on several threads at once: it may modify the components
+     * it receives, but any structural change must be recorded through
+     * commands(), which gives each thread its own buffer.
+     *
+     * @tparam Components Component types to include.
+     * @param func Callable with signature `void(Entity, Components&...)`.
+     * @param grainSize Number of entities per job.
+     */
+    template <typename... Components, typename Func>
+    void parallelEach(
+        Func&& func, size_t grainSize = JobSystem::DEFAULT_GRAIN_SIZE)
+    {
+        std::tuple<ComponentPool<Components>*...> pools(
+            findPool<Components>()...);
 
-        if (!smallestPool)
+        if ((archetypeComponents.test(
+                 ComponentRegistry::typeID<Components>()) ||
+             ...)) {
+            parallelEachInArchetypes<Components...>(
+                pools, func, std::index_sequence_for<Components...>{});
             return;
+        }
 
-        for (size_t i = 0; i < smallestPool->size(); ++i) {
-            Entity e = smallestPool->getEntityAt(i);
-            if ((has<Components>(e) && ...)) {
-                func(e, get<Components>(e)...);
+        parallelEachIn(
+            pools, func, grainSize, std::index_sequence_for<Components...>{});
+    }
+
+    /**
+     * @brief Returns the job system shared by the scheduler and
+     * parallelEach(): the engine-wide one (see Scheduler::sharedJobs()), or
+     * one of its own after setWorkerCount().
+     */
+    JobSystem& jobs()
+    {
+        return scheduler.jobs();
+    }
+
+    /**
+     * @brief Returns the persistent group of entities holding `Owned...` and
+     * `Observed...`, creating it on first use.
+     *
+     * The pools of `Owned...` are kept packed by the group, so iterating it
+     * walks contiguous arrays without probing every pool per entity. A pool
+     * can only be owned by one group; requesting a second group owning it
+     * throws `std::logic_error`.
+     *
+     * If one of the components is archetype-stored, the group packs nothing
+     * and its each() forwards to each().
+     *
+     * Creating a group reorders its owned pools, so a system owning a group
+     * must declare the owned components as written.
+     *
+     * @tparam Owned Component types owned by the group.
+     * @tparam Observed Component types the members must also have.
+     * @return Reference to the group, valid until `clear()`.
+     */
+    template <typename... Owned, typename... Observed>
+    Group<std::tuple<Owned...>, std::tuple<Observed...>>& group(
+        Observe<Observed...> = {})
+    {
+        using GroupType = Group<std::tuple<Owned...>, std::tuple<Observed...>>;
+
+        std::lock_guard<std::mutex> lock(groupMutex);
+        for (auto& existing : groups) {
+            if (auto* found = dynamic_cast<GroupType*>(existing.get())) {
+                return *found;
             }
         }
+
+        if ((storedInArchetypes<Owned>(ComponentRegistry::typeID<Owned>()) ||
+             ...) ||
+            (storedInArchetypes<Observed>(
+                 ComponentRegistry::typeID<Observed>()) ||
+             ...)) {
+            auto forwarding = std::make_unique<GroupType>(*this);
+            GroupType* ptr = forwarding.get();
+            (ptr->owned.set(ComponentRegistry::typeID<Owned>()), ...);
+            (ptr->observed.set(ComponentRegistry::typeID<Observed>()), ...);
+            groups.push_back(std::move(forwarding));
+            return *ptr;
+        }
+
+        if (((assurePool<Owned>().owner != nullptr) || ...)) {
+            throw std::logic_error(
+                "[Registry] Component pool already owned by another group");
+        }
+
+        auto created = std::make_unique<GroupType>(
+            *this, assurePool<Owned>()..., assurePool<Observed>()...);
+        GroupType* ptr = created.get();
+
+        (ptr->owned.set(ComponentRegistry::typeID<Owned>()), ...);
+        (ptr->observed.set(ComponentRegistry::typeID<Observed>()), ...);
+        ((assurePool<Owned>().owner = ptr), ...);
+        (assurePool<Owned>().groups.push_back(ptr), ...);
+        (assurePool<Observed>().groups.push_back(ptr), ...);
+
+        // Seed the group with the entities that already match
+        using Lead = std::tuple_element_t<0, std::tuple<Owned...>>;
+        auto& lead = assurePool<Lead>().storage;
+        for (size_t i = 0; i < lead.size(); ++i) {
+            const Entity e = lead.begin()[i];
+            if (ptr->matches(entityManager.signature(e))) {
+                ptr->onEmplace(e);
+            }
+        }
+
+        groups.push_back(std::move(created));
+        return *ptr;
+    }
+
+    /**
+     * @brief Reorders the `Component` pool so that each() walks it in the
+     * order of `compare`.
+     *
+     * If the pool is owned by a group, its members and the other entities
+     * are sorted separately, and every pool owned by the group follows the
+     * members, so the group stays packed.
+     *
+     * Must not be called while iterating or while systems run.
+     *
+     * @param compare Strict weak ordering on `const Component&`.
+     * @throws std::logic_error if `Component` is archetype-stored.
+     */
+    template <typename Component, typename Compare>
+    void sort(Compare compare)
+    {
+        static_assert(
+            !isTagComponent<Component>,
+            "Tags hold no value to sort by, use sort<Tag, From>()");
+
+        auto& pool = sortablePool<Component>();
+        const auto& data = pool.storage.components();
+        const size_t members = pool.owner ? pool.owner->packed() : 0;
+
+        std::vector<size_t> order(data.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        auto before = [&](size_t lhs, size_t rhs) {
+            return compare(data[lhs], data[rhs]);
+        };
+        std::sort(order.begin(), order.begin() + members, before);
+        std::sort(order.begin() + members, order.end(), before);
+        permute(pool, members, order);
+    }
+
+    /**
+     * @brief Reorders the `To` pool to follow the order of the `From` pool.
+     *
+     * Entities having both components come first, in the order of `From`,
+     * so a joined each() driven by either pool reads both linearly. Group
+     * members of `To` stay packed at the front, in the order of `From`.
+     *
+     * Must not be called while iterating or while systems run.
+     *
+     * @throws std::logic_error if either component is archetype-stored.
+     */
+    template <typename To, typename From>
+    void sort()
+    {
+        static_assert(
+            !std::is_same_v<To, From>, "A pool already follows its own order");
+
+        sortablePool<From>();
+        coOrder<To, From>(sortablePool<To>());
+    }
+
+    /**
+     * @brief Keeps the `Component` pool sorted by running an insertion sort
+     * for at most `budget` at the start of every fixed step.
+     *
+     * The pool converges over several steps and then stays sorted at the
+     * cost of one comparison per component and step, as long as entities
+     * move slowly relative to each other. Each time a pass reaches the end
+     * of the pool, the `Followers` pools are co-ordered with it (see
+     * sort<To, From>()), which costs one pass over the pool.
+     *
+     * Replaces the previous incremental sort of `Component`.
+     *
+     * @param compare Strict weak ordering on `const Component&`.
+     * @param budget Time the sort may take per fixed step.
+     * @throws std::logic_error if a component is archetype-stored.
+     */
+    template <typename Component, typename... Followers, typename Compare>
+    void sortIncrementally(Compare compare, std::chrono::microseconds budget)
+    {
+        static_assert(
+            !isTagComponent<Component>,
+            "Tags hold no value to sort by, use sort<Tag, From>()");
+
+        sortablePool<Component>();
+        (sortablePool<Followers>(), ...);
+        stopSorting<Component>();
+
+        size_t cursor = 1;
+        incrementalSorts.push_back(
+            {ComponentRegistry::typeID<Component>(), budget,
+             [this, compare, cursor](IncrementalSort::Deadline deadline) mutable {
+                 auto& pool = assurePool<Component>();
+                 if (insertionPass(pool, compare, cursor, deadline)) {
+                     (coOrder<Followers, Component>(assurePool<Followers>()),
+                      ...);
+                 }
+             }});
+    }
+
+    /// @brief Cancels the incremental sort of `Component`, if any.
+    template <typename Component>
+    void stopSorting()
+    {
+        const ComponentID id = ComponentRegistry::typeID<Component>();
+        incrementalSorts.erase(
+            std::remove_if(
+                incrementalSorts.begin(), incrementalSorts.end(),
+                [id](const IncrementalSort& sort) { return sort.id == id; }),
+            incrementalSorts.end());
+    }
+
+    /**
+     * @brief Returns the command buffer of the calling thread.
+     *
+     * Structural changes recorded there are applied by flushCommands(),
+     * which update() calls after every system. Use it instead of
+     * create()/emplace()/destroy() while iterating.
+     */
+    CommandBuffer& commands()
+    {
+        std::lock_guard<std::mutex> lock(commandMutex);
+
+        auto it = commandBuffersByThread.find(std::this_thread::get_id());
+        if (it != commandBuffersByThread.end()) {
+            return *it->second;
+        }
+
+        commandBuffers.push_back(std::make_unique<CommandBuffer>(*this));
+        CommandBuffer* buffer = commandBuffers.back().get();
+        commandBuffersByThread.emplace(std::this_thread::get_id(), buffer);
+        return *buffer;
+    }
+
+    /**
+     * @brief Plays back every recorded command buffer in one sorted batch.
+     *
+     * Staged components are emplaced type by type, then removals and
+     * deduplicated destructions are applied. Commands recorded by signal
+     * listeners during playback are applied by a further batch, until every
+     * buffer is empty. Must not run concurrently with recording threads.
+     */
+    void flushCommands()
+    {
+        while (hasPendingCommands()) {
+            playbackCommands();
+        }
     }
 
     /**
@@ -240,6 +914,7 @@ class Registry
         auto* ptr = system.get();
         systems.push_back(std::move(system));
         sortSystems();
+        ptr->onAttach(*this);
 
         std::cout << "[Registry] System added: " << ptr->getName() << "\n";
         updateSystemAvailability();
@@ -256,45 +931,120 @@ class Registry
         SystemID id = nextSystemID++;
         system->setSystemID(id);
 
+        ISystem* ptr = system.get();
         systems.push_back(std::move(system));
         sortSystems();
+        ptr->onAttach(*this);
 
         std::cout << "[Registry] Dynamic system added\n";
         updateSystemAvailability();
     }
 
     /**
-     * @brief Removes a system of the given type.
+     * @brief Removes a system of the given type, calling its onDetach()
+     * first.
      */
     template <typename SystemType>
     void removeSystem()
     {
-        systems.erase(
-            std::remove_if(
-                systems.begin(), systems.end(),
-                [](const auto& sys) {
-                    return dynamic_cast<SystemType*>(sys.get()) != nullptr;
-                }),
-            systems.end());
+        auto removed = std::stable_partition(
+            systems.begin(), systems.end(), [](const auto& sys) {
+                return dynamic_cast<SystemType*>(sys.get()) == nullptr;
+            });
+        for (auto it = removed; it != systems.end(); ++it) {
+            (*it)->onDetach(*this);
+        }
+        systems.erase(removed, systems.end());
     }
 
     /**
      * @brief Updates all active systems based on the simulation clock.
+     *
+     * Non-conflicting systems run concurrently (see `Scheduler`); the
+     * command buffers are flushed after each stage.
+     *
      * @param realDt Real-world delta time (in seconds).
      */
     void update(float realDt)
     {
         int steps = gameClock.update(realDt);
+        const uint64_t firstStep = gameClock.frameCount - steps + 1;
 
         for (int i = 0; i < steps; i++) {
             float fixedDt = gameClock.getFixedDeltaTime();
-
-            for (auto& system : systems) {
-                if (system->enabled) {
-                    system->update(*this, fixedDt);
-                }
+            currentTick = firstStep + i;
+            frameArena.reset();
+            for (IncrementalSort& sort : incrementalSorts) {
+                sort.step(IncrementalSort::Clock::now() + sort.budget);
             }
+            scheduler.run(
+                *this, systems, fixedDt, currentTick,
+                [this] { flushCommands(); });
         }
+        currentTick = gameClock.frameCount + 1;
+    }
+
+    /**
+     * @brief Sets the number of threads running systems besides the caller.
+     *
+     * Registries left at Scheduler::defaultWorkerCount() share the workers
+     * of Scheduler::sharedJobs(); other counts start workers of their own.
+     *
+     * @param count Worker count; 0 runs every system sequentially.
+     */
+    void setWorkerCount(size_t count)
+    {
+        scheduler.setWorkerCount(count);
+    }
+
+    /// @brief Returns the number of threads running systems besides the caller.
+    size_t getWorkerCount() const
+    {
+        return scheduler.getWorkerCount();
+    }
+
+    /**
+     * @brief Returns the per-system durations of the last fixed step.
+     */
+    const TickTimings& getTimings() const
+    {
+        return scheduler.getTimings();
+    }
+
+    /**
+     * @brief Returns the profiler of the fixed steps, disabled by default.
+     *
+     * ```cpp
+     * registry.profiler().enable();
+     * registry.profiler().captureTrace(registry.tick(), registry.tick() + 60);
+     * // ... 60 ticks later
+     * registry.profiler().writeChromeTrace("tick.json");
+     * ```
+     */
+    Profiler& profiler()
+    {
+        return scheduler.profiler();
+    }
+
+    /// @brief Const version of profiler().
+    const Profiler& profiler() const
+    {
+        return scheduler.profiler();
+    }
+
+    /**
+     * @brief Returns the arena for allocations living until the next fixed
+     * step.
+     *
+     * Reset at the start of every fixed step, before any system runs, and
+     * safe to allocate from concurrently. Typical use in a system:
+     * ```cpp
+     * std::pmr::vector<Entity> hits(&registry.frame());
+     * ```
+     */
+    FrameArena& frame()
+    {
+        return frameArena;
     }
 
     /// @brief Returns a const reference to the internal game clock.
@@ -345,11 +1095,40 @@ class Registry
         entityManager.reserve(capacity);
     }
 
+    /**
+     * @brief Preallocates the pool of `Component` for `capacity` instances.
+     * Archetype-stored types grow by whole chunks and ignore it.
+     */
+    template <typename Component>
+    void reserve(size_t capacity)
+    {
+        ComponentID id = ComponentRegistry::typeID<Component>();
+        if (storedInArchetypes<Component>(id))
+            return;
+        assurePool<Component>(id).storage.reserve(capacity);
+    }
+
+    /**
+     * @brief Returns how many `Component` instances fit in its pool before
+     * it reallocates; 0 for archetype-stored types and missing pools.
+     */
+    template <typename Component>
+    size_t capacity() const
+    {
+        const auto* pool = findPool<Component>();
+        return pool ? pool->storage.capacity() : 0;
+    }
+
     /**
      * @brief Clears all entities, components, and systems.
      */
     void clear()
     {
+        for (auto& buffer : commandBuffers) {
+            buffer->clear();
+        }
+        groups.clear();
+        archetypes.clear();
         componentPools.clear();
         componentPools.reserve(MAX_COMPONENTS);
         entityManager.clear();
@@ -379,111 +1158,627 @@ class Registry
     template <typename Component>
     size_t count() const
     {
-        ComponentID id =
-            ComponentRegistry::instance().getOrCreateID<Component>();
+        ComponentID id = ComponentRegistry::typeID<Component>();
+        if (archetypeComponents.test(id))
+            return archetypes.count(id);
         if (id >= componentPools.size() || !componentPools[id])
             return 0;
         return componentPools[id]->size();
     }
-    int score = 0;
+
+    /**
+     * @brief Returns the per-world singletons (see `Resources`).
+     *
+     * Unlike entities and components, resources survive clear().
+     */
+    Resources& resources()
+    {
+        return worldResources;
+    }
+
+    /// @brief Const version of resources().
+    const Resources& resources() const
+    {
+        return worldResources;
+    }
 
    private:
     GameEngine::GameClock
         gameClock;  ///< Manages real-time and fixed-step updates.
 
-    /** @brief Abstract base for all component pools. */
-    struct IComponentPool
+    friend class CommandBuffer;
+
+    /// @brief Checks if any command buffer holds unapplied commands.
+    bool hasPendingCommands() const
     {
-        virtual ~IComponentPool() = default;
-        virtual void remove(Entity e) = 0;
-        virtual size_t size() const = 0;
-        virtual Entity getEntityAt(size_t index) const = 0;
-    };
+        for (const auto& buffer : commandBuffers) {
+            if (!buffer->empty())
+                return true;
+        }
+        return false;
+    }
 
     /**
-     * @brief Templated component pool for a specific component type.
-     * Uses SparseSet for efficient storage and lookup.
+     * @brief Applies the commands recorded so far, as one flushCommands()
+     * batch.
+     *
+     * Every list is taken out of its buffer before it is played back, so
+     * listeners may record into any buffer, even create the buffer of the
+     * current thread; buffers are walked by index for that reason.
      */
-    template <typename Component>
-    struct ComponentPool : IComponentPool
+    void playbackCommands()
     {
-        SparseSet<Entity, Component> storage;
+        size_t stagedTypes = 0;
+        for (size_t i = 0; i < commandBuffers.size(); ++i) {
+            stagedTypes =
+                std::max(stagedTypes, commandBuffers[i]->staged.size());
+        }
+
+        for (size_t id = 0; id < stagedTypes; ++id) {
+            for (size_t i = 0; i < commandBuffers.size(); ++i) {
+                CommandBuffer& buffer = *commandBuffers[i];
+                if (id < buffer.staged.size() && buffer.staged[id]) {
+                    const size_t played = buffer.staged[id]->playback(*this);
+                    buffer.pending -= played;
+                }
+            }
+        }
+
+        pendingRemovals.clear();
+        for (size_t i = 0; i < commandBuffers.size(); ++i) {
+            CommandBuffer& buffer = *commandBuffers[i];
+            pendingRemovals.insert(
+                pendingRemovals.end(), buffer.removals.begin(),
+                buffer.removals.end());
+            buffer.pending -= buffer.removals.size();
+            buffer.removals.clear();
+        }
+        if (!pendingRemovals.empty()) {
+            std::sort(pendingRemovals.begin(), pendingRemovals.end());
+            for (const auto& [id, e] : pendingRemovals) {
+                removeByID(id, e);
+            }
+        }
 
-        void remove(Entity e) override
-        {
-            storage.erase(e);
+        pendingDestructions.clear();
+        for (size_t i = 0; i < commandBuffers.size(); ++i) {
+            CommandBuffer& buffer = *commandBuffers[i];
+            pendingDestructions.insert(
+                pendingDestructions.end(), buffer.destructions.begin(),
+                buffer.destructions.end());
+            buffer.pending -= buffer.destructions.size();
+            buffer.destructions.clear();
         }
-        size_t size() const override
-        {
-            return storage.size();
+        if (!pendingDestructions.empty()) {
+            std::sort(pendingDestructions.begin(), pendingDestructions.end());
+            pendingDestructions.erase(
+                std::unique(
+                    pendingDestructions.begin(), pendingDestructions.end()),
+                pendingDestructions.end());
+            for (Entity e : pendingDestructions) {
+                destroy(e);
+            }
         }
-        Entity getEntityAt(size_t index) const override
-        {
-            return storage.begin()[index];
+    }
+
+    /**
+     * @brief Removes component `id` from entity `e`, keeping groups, the
+     * entity signature and system availability in sync.
+     */
+    void removeByID(ComponentID id, Entity e)
+    {
+        // Also rejects stale handles, whose signature is empty
+        if (!entityManager.signature(e).test(id))
+            return;
+
+        if (observedComponents.test(id)) {
+            componentSignals[id].destroy.publish(*this, e);
+        }
+
+        if (archetypeComponents.test(id)) {
+            if (!archetypes.remove(e, id))
+                return;
+            entityManager.removeComponent(e, id);
+            if (archetypes.count(id) == 0) {
+                std::cout << "[Registry] Last component of type removed, "
+                             "updating system availability\n";
+                availableComponents.reset(id);
+                updateSystemAvailability();
+            }
+            return;
+        }
+
+        if (id >= componentPools.size() || !componentPools[id])
+            return;
+
+        IComponentPool* pool = componentPools[id].get();
+        if (!pool->contains(e))
+            return;
+
+        for (IGroup* group : pool->groups) {
+            group->onRemove(e);
         }
+        pool->remove(e);
+        entityManager.removeComponent(e, id);
 
-        template <typename... Args>
-        Component& emplace(Entity e, Args&&... args)
-        {
-            return storage.emplace(e, std::forward<Args>(args)...);
+        if (pool->size() == 0) {
+            std::cout << "[Registry] Last component of type removed, "
+                         "updating system availability\n";
+            availableComponents.reset(id);
+            updateSystemAvailability();
         }
+    }
+
+    /// @brief Entity allocation usable from any recording thread.
+    Entity createDeferred()
+    {
+        std::lock_guard<std::mutex> lock(commandMutex);
+        return entityManager.create();
+    }
+
+    /**
+     * @brief Resolves the backend of `Component` on first use.
+     * @return True if `Component` is archetype-stored.
+     */
+    template <typename Component>
+    bool storedInArchetypes(ComponentID id)
+    {
+        if (!resolvedStorage.test(id)) {
+            resolvedStorage.set(id);
 
-        void erase(Entity e)
-        {
-            storage.erase(e);
+            StorageMode mode = ComponentStorage<Component>::mode;
+            if (mode == StorageMode::Default) {
+                mode = defaultStorage;
+            }
+            if (mode == StorageMode::Archetype) {
+                archetypeComponents.set(id);
+                archetypes.registerType<Component>(id);
+            }
         }
-        bool contains(Entity e) const
-        {
-            return storage.contains(e);
+        return archetypeComponents.test(id);
+    }
+
+    /// @brief emplace() for an archetype-stored component.
+    template <typename Component, typename... Args>
+    Component& emplaceInArchetype(Entity e, ComponentID id, Args&&... args)
+    {
+        if (entityManager.signature(e).test(id)) {
+            return archetypes.get<Component>(e, id);
         }
-        Component& get(Entity e)
-        {
-            return storage.get(e);
+
+        Component& component =
+            archetypes.emplace<Component>(e, id, std::forward<Args>(args)...);
+        entityManager.addComponent(e, id);
+
+        if (archetypes.count(id) == 1) {
+            ECS_LOG("[Registry] First component of type added, updating system availability\n");
+            availableComponents.set(id);
+            updateSystemAvailability();
         }
-        const Component& get(Entity e) const
-        {
-            return storage.get(e);
+
+        if (observedComponents.test(id)) {
+            componentSignals[id].construct.publish(*this, e);
         }
-        bool empty() const
-        {
-            return storage.empty();
+        return component;
+    }
+
+    /**
+     * @brief Returns the pool of `Component` for the sort functions.
+     * @throws std::logic_error if `Component` is archetype-stored.
+     */
+    template <typename Component>
+    ComponentPool<Component>& sortablePool()
+    {
+        const ComponentID id = ComponentRegistry::typeID<Component>();
+        if (storedInArchetypes<Component>(id)) {
+            throw std::logic_error(
+                "[Registry] Only SparseSet-backed components can be sorted");
         }
+        return assurePool<Component>(id);
+    }
 
-        auto begin()
-        {
-            return storage.begin();
+    /**
+     * @brief Swaps two dense positions of `pool`, both below or both above
+     * `members`; member positions move every pool owned by the group.
+     */
+    template <typename Component>
+    static void swapInPool(
+        ComponentPool<Component>& pool, size_t members, size_t lhs, size_t rhs)
+    {
+        if (lhs < members) {
+            pool.owner->swapMembers(lhs, rhs);
+        } else {
+            pool.storage.swapAt(lhs, rhs);
         }
-        auto end()
-        {
-            return storage.end();
+    }
+
+    /**
+     * @brief Moves the component at dense position `order[k]` to `k`, for
+     * every k. `order` must not move positions across `members`.
+     */
+    template <typename Component>
+    static void permute(
+        ComponentPool<Component>& pool, size_t members,
+        const std::vector<size_t>& order)
+    {
+        // position[i]: where the component first at i is now; at[k]: the
+        // reverse mapping.
+        std::vector<size_t> position(order.size());
+        std::vector<size_t> at(order.size());
+        std::iota(position.begin(), position.end(), size_t{0});
+        std::iota(at.begin(), at.end(), size_t{0});
+
+        for (size_t k = 0; k < order.size(); ++k) {
+            const size_t from = position[order[k]];
+            if (from == k)
+                continue;
+
+            swapInPool(pool, members, k, from);
+            position[at[k]] = from;
+            at[from] = at[k];
+            position[order[k]] = k;
+            at[k] = order[k];
         }
-        auto begin() const
-        {
-            return storage.begin();
+    }
+
+    /// @brief Body of sort<To, From>().
+    template <typename To, typename From>
+    void coOrder(ComponentPool<To>& to)
+    {
+        const auto& from = assurePool<From>();
+        if (to.owner != nullptr && to.owner == from.owner)
+            return;  // The group keeps them in lockstep already
+
+        const size_t members = to.owner ? to.owner->packed() : 0;
+        size_t nextMember = 0;
+        size_t nextOther = members;
+        for (Entity e : from.storage) {
+            if (!to.storage.contains(e))
+                continue;
+
+            const size_t i = to.storage.index(e);
+            if (i < members) {
+                to.owner->swapMembers(nextMember++, i);
+            } else {
+                to.storage.swapAt(nextOther++, i);
+            }
         }
-        auto end() const
-        {
-            return storage.end();
+    }
+
+    /**
+     * @brief Runs insertion sort steps on `pool` from `cursor` until the end
+     * of the pool or `deadline`.
+     * @return True if the pass reached the end of the pool, in which case
+     * `cursor` restarts at the beginning.
+     */
+    template <typename Component, typename Compare>
+    static bool insertionPass(
+        ComponentPool<Component>& pool, Compare& compare, size_t& cursor,
+        std::chrono::steady_clock::time_point deadline)
+    {
+        constexpr size_t CLOCK_PERIOD = 64;  // Steps between clock reads
+
+        const auto& data = pool.storage.components();
+        const size_t members = pool.owner ? pool.owner->packed() : 0;
+        size_t steps = 0;
+
+        for (; cursor < data.size(); ++cursor) {
+            const size_t lowest = cursor < members ? 0 : members;
+            for (size_t j = cursor; j > lowest && compare(data[j], data[j - 1]);
+                 --j) {
+                swapInPool(pool, members, j - 1, j);
+                steps++;
+            }
+            if (++steps >= CLOCK_PERIOD) {
+                steps = 0;
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    ++cursor;
+                    return false;
+                }
+            }
         }
+        cursor = 1;
+        return true;
+    }
+
+    /// @brief Sort registered by sortIncrementally().
+    struct IncrementalSort
+    {
+        using Clock = std::chrono::steady_clock;
+        using Deadline = Clock::time_point;
+
+        ComponentID id;  ///< Sorted component.
+        std::chrono::microseconds budget;  ///< Time allowed per fixed step.
+        std::function<void(Deadline)> step;  ///< Sorts until the deadline.
+    };
+
+    /// @brief Lifecycle signals of one component type.
+    struct ComponentSignals
+    {
+        ComponentSignal construct;  ///< See onConstruct().
+        ComponentSignal update;  ///< See onUpdate().
+        ComponentSignal destroy;  ///< See onDestroy().
     };
 
+    /**
+     * @brief Returns the signals of component `id`, marking it observed so
+     * that its changes start being published.
+     */
+    ComponentSignals& signalsOf(ComponentID id)
+    {
+        if (id >= componentSignals.size()) {
+            componentSignals.resize(id + 1);
+        }
+        observedComponents.set(id);
+        return componentSignals[id];
+    }
+
     /**
      * @brief Ensures that a component pool exists for the given component ID.
      * Creates it if necessary.
      */
     template <typename Component>
-    SparseSet<Entity, Component>& assurePool(ComponentID id)
+    ComponentPool<Component>& assurePool(ComponentID id)
     {
         if (id >= componentPools.size()) {
             componentPools.resize(id + 1);
         }
 
         if (!componentPools[id]) {
-            componentPools[id] = std::make_unique<ComponentPool<Component>>();
+            componentPools[id] = std::make_unique<ComponentPool<Component>>(
+                std::pmr::polymorphic_allocator<Component>(poolResource));
         }
 
-        return static_cast<ComponentPool<Component>*>(componentPools[id].get())
-            ->storage;
+        return *static_cast<ComponentPool<Component>*>(componentPools[id].get());
+    }
+
+    /// @brief assurePool() for a statically known component type.
+    template <typename Component>
+    ComponentPool<Component>& assurePool()
+    {
+        return assurePool<Component>(ComponentRegistry::typeID<Component>());
+    }
+
+    /**
+     * @brief Returns the pool of `Component`, or nullptr if none exists yet.
+     * Unlike assurePool(), never allocates.
+     */
+    template <typename Component>
+    ComponentPool<Component>* findPool() const
+    {
+        ComponentID id = ComponentRegistry::typeID<Component>();
+        if (id >= componentPools.size() || !componentPools[id])
+            return nullptr;
+        return static_cast<ComponentPool<Component>*>(componentPools[id].get());
+    }
+
+    /**
+     * @brief Drives each() from the smallest of the resolved pools.
+     * Returns immediately if one of the component types has no pool.
+     */
+    template <typename Pools, typename Func, size_t... Is>
+    void eachIn(Pools& pools, Func& func, std::index_sequence<Is...> seq)
+    {
+        if (((std::get<Is>(pools) == nullptr) || ...))
+            return;
+
+        const size_t sizes[] = {std::get<Is>(pools)->size()...};
+        const size_t driver =
+            std::min_element(std::begin(sizes), std::end(sizes)) -
+            std::begin(sizes);
+
+        const uint64_t stamps[] = {iterationStamp(std::get<Is>(pools))...};
+
+        ECS_PROFILE_ENTITIES(sizes[driver]);
+        ((driver == Is ? eachFrom<Is>(pools, stamps, func, seq, 0, SIZE_MAX)
+                       : void()),
+         ...);
+    }
+
+    /**
+     * @brief parallelEach() counterpart of eachIn(): splits the dense array
+     * of the smallest pool into jobs.
+     */
+    template <typename Pools, typename Func, size_t... Is>
+    void parallelEachIn(
+        Pools& pools, Func& func, size_t grainSize,
+        std::index_sequence<Is...> seq)
+    {
+        if (((std::get<Is>(pools) == nullptr) || ...))
+            return;
+
+        const size_t sizes[] = {std::get<Is>(pools)->size()...};
+        const size_t driver =
+            std::min_element(std::begin(sizes), std::end(sizes)) -
+            std::begin(sizes);
+
+        const uint64_t stamps[] = {iterationStamp(std::get<Is>(pools))...};
+
+        ECS_PROFILE_ENTITIES(sizes[driver]);
+        ((driver == Is ? jobs().parallelFor(
+                             sizes[Is], grainSize,
+                             [&](size_t begin, size_t end) {
+                                 eachFrom<Is>(
+                                     pools, stamps, func, seq, begin, end);
+                             })
+                       : void()),
+         ...);
+    }
+
+    /**
+     * @brief Walks [begin, end) of the dense array of pool `Driver`, probing
+     * only the other pools already resolved by eachIn().
+     * @param stamps iterationStamp() of each pool.
+     */
+    template <size_t Driver, typename Pools, typename Func, size_t... Is>
+    void eachFrom(
+        Pools& pools, const uint64_t* stamps, Func& func,
+        std::index_sequence<Is...>, size_t begin, size_t end)
+    {
+        auto& driver = std::get<Driver>(pools)->storage;
+
+        for (size_t i = begin; i < end && i < driver.size(); ++i) {
+            const Entity e = driver.begin()[i];
+            if (((Is == Driver || std::get<Is>(pools)->storage.contains(e)) &&
+                 ...)) {
+                func(e, std::get<Is>(pools)->storage.visit(e, stamps[Is])...);
+            }
+        }
+    }
+
+    /**
+     * @brief each() when at least one component is archetype-stored.
+     *
+     * Walks every archetype holding the archetype-stored components, chunk
+     * by chunk and from the back. SparseSet-backed components are checked
+     * against the entity signature and fetched through their pool.
+     */
+    template <
+        typename... Components, typename Pools, typename Func, size_t... Is>
+    void eachInArchetypes(Pools& pools, Func& func, std::index_sequence<Is...>)
+    {
+        const ComponentID ids[] = {ComponentRegistry::typeID<Components>()...};
+
+        ComponentSignature required;
+        ComponentSignature pooled;
+        for (ComponentID id : ids) {
+            (archetypeComponents.test(id) ? required : pooled).set(id);
+        }
+        if (((!archetypeComponents.test(ids[Is]) &&
+              std::get<Is>(pools) == nullptr) ||
+             ...))
+            return;
+        const uint64_t stamps[] = {iterationStamp(std::get<Is>(pools))...};
+
+        if (pooled.none()) {
+            archetypes.forEachMatching(required, [&](Archetype& archetype) {
+                const int columns[] = {archetype.column(ids[Is])...};
+
+                for (size_t c = archetype.chunkCount(); c-- > 0;) {
+                    ECS_PROFILE_ENTITIES(archetype.rowsIn(c));
+                    std::tuple<Components*...> data(static_cast<Components*>(
+                        archetype.columnData(c, columns[Is]))...);
+                    const Entity* entities = archetype.entities(c);
+
+                    for (size_t i = archetype.rowsIn(c); i-- > 0;) {
+                        if (i >= archetype.rowsIn(c))
+                            continue;
+                        func(entities[i], std::get<Is>(data)[i]...);
+                    }
+                }
+            });
+            return;
+        }
+
+        archetypes.forEachMatching(required, [&](Archetype& archetype) {
+            for (size_t c = archetype.chunkCount(); c-- > 0;) {
+                ECS_PROFILE_ENTITIES(archetype.rowsIn(c));
+                eachInChunk<Components...>(
+                    archetype, c, pooled, pools, stamps, func,
+                    std::index_sequence_for<Components...>{});
+            }
+        });
+    }
+
+    /**
+     * @brief parallelEach() counterpart of eachInArchetypes(): one job per
+     * matching chunk.
+     */
+    template <
+        typename... Components, typename Pools, typename Func, size_t... Is>
+    void parallelEachInArchetypes(
+        Pools& pools, Func& func, std::index_sequence<Is...>)
+    {
+        const ComponentID ids[] = {ComponentRegistry::typeID<Components>()...};
+
+        ComponentSignature required;
+        ComponentSignature pooled;
+        for (ComponentID id : ids) {
+            (archetypeComponents.test(id) ? required : pooled).set(id);
+        }
+        if (((!archetypeComponents.test(ids[Is]) &&
+              std::get<Is>(pools) == nullptr) ||
+             ...))
+            return;
+        const uint64_t stamps[] = {iterationStamp(std::get<Is>(pools))...};
+
+        std::vector<std::pair<Archetype*, size_t>> chunks;
+        archetypes.forEachMatching(required, [&](Archetype& archetype) {
+            for (size_t c = 0; c < archetype.chunkCount(); ++c) {
+                ECS_PROFILE_ENTITIES(archetype.rowsIn(c));
+                chunks.emplace_back(&archetype, c);
+            }
+        });
+
+        jobs().parallelFor(chunks.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t k = begin; k < end; ++k) {
+                eachInChunk<Components...>(
+                    *chunks[k].first, chunks[k].second, pooled, pools, stamps,
+                    func, std::index_sequence_for<Components...>{});
+            }
+        });
+    }
+
+    /**
+     * @brief Visits the rows of chunk `c` of `archetype` from the back,
+     * skipping entities missing one of the `pooled` components.
+     */
+    template <
+        typename... Components, typename Pools, typename Func, size_t... Is>
+    void eachInChunk(
+        Archetype& archetype, size_t c, const ComponentSignature& pooled,
+        Pools& pools, const uint64_t* stamps, Func& func,
+        std::index_sequence<Is...>)
+    {
+        const int columns[] = {
+            archetype.column(ComponentRegistry::typeID<Components>())...};
+        void* bases[] = {
+            columns[Is] >= 0 ? archetype.columnData(c, columns[Is])
+                             : nullptr...};
+        const Entity* entities = archetype.entities(c);
+
+        for (size_t i = archetype.rowsIn(c); i-- > 0;) {
+            if (i >= archetype.rowsIn(c))
+                continue;
+
+            const Entity e = entities[i];
+            if (pooled.any() &&
+                (entityManager.signature(e) & pooled) != pooled)
+                continue;
+
+            func(
+                e,
+                fetch(std::get<Is>(pools), bases[Is], i, e, stamps[Is])...);
+        }
+    }
+
+    /// @brief Returns the component of row `i` if `base` is a chunk column,
+    /// or the one of `e` in `pool` otherwise, stamped with `stamp`.
+    template <typename Component>
+    static Component& fetch(
+        ComponentPool<Component>* pool, void* base, size_t i, Entity e,
+        uint64_t stamp)
+    {
+        return base ? static_cast<Component*>(base)[i]
+                    : pool->storage.visit(e, stamp);
+    }
+
+    /**
+     * @brief Returns the `Component` of `e` for the optional components of
+     * each(), or nullptr if `signature` does not hold it.
+     * @param stamp iterationStamp() of `pool`.
+     */
+    template <typename Component>
+    Component* optionalOf(
+        const ComponentSignature& signature, ComponentPool<Component>* pool,
+        Entity e, uint64_t stamp)
+    {
+        const ComponentID id = ComponentRegistry::typeID<Component>();
+        if (!signature.test(id))
+            return nullptr;
+        if (archetypeComponents.test(id))
+            return &archetypes.get<Component>(e, id);
+        return &pool->storage.visit(e, stamp);
     }
 
     /// @brief Sorts systems by priority (ascending order).
@@ -496,10 +1791,110 @@ class Registry
     }
 
     EntityManager entityManager;  ///< Handles entity creation and destruction.
+    StorageMode defaultStorage;  ///< Backend of `StorageMode::Default` types.
+    std::pmr::memory_resource*
+        poolResource;  ///< Memory of the SparseSet pools.
+    FrameArena frameArena;  ///< Scratch memory of the current fixed step.
+    Resources worldResources;  ///< Per-world singletons.
+    uint64_t currentTick = 1;  ///< Stamp of tracked writes (see tick()).
+    ArchetypeStorage archetypes;  ///< Storage of archetype-backed components.
+    ComponentSignature
+        resolvedStorage;  ///< Types whose backend has been resolved.
+    ComponentSignature
+        archetypeComponents;  ///< Types stored in `archetypes`.
     std::vector<std::unique_ptr<IComponentPool>>
         componentPools;  ///< Storage pools for all component types.
+    std::vector<std::unique_ptr<IGroup>>
+        groups;  ///< Persistent groups, kept in sync with the pools.
+    std::vector<ComponentSignals>
+        componentSignals;  ///< Lifecycle signals, by component ID.
+    ComponentSignature
+        observedComponents;  ///< Types whose signals were requested.
+    std::vector<IncrementalSort>
+        incrementalSorts;  ///< Run at the start of every fixed step.
     std::vector<std::unique_ptr<ISystem>> systems;  ///< All registered systems.
+    Scheduler scheduler;  ///< Runs the systems, possibly concurrently.
+    std::mutex groupMutex;  ///< Guards lazy group creation.
+
+    std::mutex commandMutex;  ///< Guards buffer lookup and deferred creation.
+    std::vector<std::unique_ptr<CommandBuffer>>
+        commandBuffers;  ///< One buffer per recording thread.
+    std::unordered_map<std::thread::id, CommandBuffer*>
+        commandBuffersByThread;  ///< Buffer of each recording thread.
+    std::vector<std::pair<ComponentID, Entity>>
+        pendingRemovals;  ///< Scratch list reused by flushCommands().
+    std::vector<Entity>
+        pendingDestructions;  ///< Scratch list reused by flushCommands().
     ComponentSignature
         availableComponents;  ///< Bitset tracking which component types exist.
     SystemID nextSystemID = 0;  ///< Counter for assigning unique system IDs.
 };
+
+inline CommandBuffer::Entity CommandBuffer::create()
+{
+    return registry.createDeferred();
+}
+
+template <typename... Components, typename Func>
+void eachInRegistry(Registry& registry, Func& func)
+{
+    registry.each<Components...>(func);
+}
+
+template <typename... Components, typename Func>
+void parallelEachInRegistry(Registry& registry, Func& func, size_t grainSize)
+{
+    registry.parallelEach<Components...>(func, grainSize);
+}
+
+inline JobSystem& jobsInRegistry(Registry& registry)
+{
+    return registry.jobs();
+}
+
+template <typename Component>
+uint64_t iterationStampInRegistry(
+    const Registry& registry, const ComponentPool<Component>* pool)
+{
+    return registry.iterationStamp(pool);
+}
+
+inline const ComponentSignature& signatureInRegistry(
+    const Registry& registry, EntityManager::Entity e)
+{
+    return registry.signature(e);
+}
+
+template <typename Component>
+size_t StagedComponents<Component>::playback(Registry& registry)
+{
+    // Listeners of emplace() may stage more of `Component` meanwhile
+    replaying.swap(items);
+    for (auto& [e, component] : replaying) {
+        if (registry.valid(e)) {
+            registry.emplace<Component>(e, std::move(component));
+        }
+    }
+    const size_t played = replaying.size();
+    replaying.clear();
+    return played;
+}
+
+template <typename Component>
+void Prefab::Entry<Component>::reserve(Registry& registry, size_t count) const
+{
+    // Doubling on growth keeps repeated small batches amortized O(1)
+    const size_t size = registry.count<Component>();
+    const size_t capacity = registry.capacity<Component>();
+    if (size + count > capacity) {
+        registry.reserve<Component>(std::max(size + count, 2 * capacity));
+    }
+}
+
+template <typename Component>
+void Prefab::Entry<Component>::emplace(Registry& registry, Entity e) const
+{
+    if (!registry.has<Component>(e)) {
+        registry.emplace<Component>(e, value);
+    }
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Types.hpp"
+
+/**
+ * @class Resources
+ * @brief Per-world singletons (score, level state, settings...) owned by a
+ * `Registry`.
+ *
+ * Holds at most one value per type. Keeping such state here rather than in
+ * globals or loose members lets several registries run side by side on
+ * different threads without sharing anything mutable.
+ *
+ * Resource types are indexed by their own `ResourceID`, counted apart from
+ * component IDs. Systems declare their access with `System::readResources`
+ * and `System::writeResources`, and the scheduler orders them like
+ * component accesses.
+ */
+class Resources
+{
+   public:
+    /**
+     * @brief Returns the ID of `Resource`, assigned on first use.
+     * @throws std::length_error past MAX_RESOURCES resource types.
+     */
+    template <typename Resource>
+    static ResourceID typeID()
+    {
+        static const ResourceID id = nextID();
+        return id;
+    }
+
+    /**
+     * @brief Stores a `Resource` built from `args`, replacing the previous
+     * one.
+     * @return The stored resource.
+     */
+    template <typename Resource, typename... Args>
+    Resource& emplace(Args&&... args)
+    {
+        const ResourceID id = typeID<Resource>();
+        if (id >= slots.size()) {
+            slots.resize(id + 1);
+        }
+        auto holder =
+            std::make_unique<Holder<Resource>>(std::forward<Args>(args)...);
+        Resource& value = holder->value;
+        slots[id] = std::move(holder);
+        return value;
+    }
+
+    /**
+     * @brief Returns the `Resource` of this world, building it from `args`
+     * first if there is none.
+     */
+    template <typename Resource, typename... Args>
+    Resource& getOrEmplace(Args&&... args)
+    {
+        if (Resource* value = find<Resource>()) {
+            return *value;
+        }
+        return emplace<Resource>(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Returns the `Resource` of this world.
+     * @throws std::out_of_range if none was emplaced.
+     */
+    template <typename Resource>
+    Resource& get()
+    {
+        Resource* value = find<Resource>();
+        if (!value) {
+            throw std::out_of_range("[Resources] Resource not emplaced");
+        }
+        return *value;
+    }
+
+    /// @brief Const version of get().
+    template <typename Resource>
+    const Resource& get() const
+    {
+        return const_cast<Resources*>(this)->get<Resource>();
+    }
+
+    /// @brief Returns the `Resource` of this world, or nullptr.
+    template <typename Resource>
+    Resource* find()
+    {
+        const ResourceID id = typeID<Resource>();
+        if (id >= slots.size() || !slots[id])
+            return nullptr;
+        return &static_cast<Holder<Resource>*>(slots[id].get())->value;
+    }
+
+    /// @brief Const version of find().
+    template <typename Resource>
+    const Resource* find() const
+    {
+        return const_cast<Resources*>(this)->find<Resource>();
+    }
+
+    /// @brief Checks whether a `Resource` was emplaced.
+    template <typename Resource>
+    bool contains() const
+    {
+        return find<Resource>() != nullptr;
+    }
+
+    /// @brief Destroys the `Resource`, if any.
+    template <typename Resource>
+    void erase()
+    {
+        const ResourceID id = typeID<Resource>();
+        if (id < slots.size()) {
+            slots[id].reset();
+        }
+    }
+
+    /// @brief Destroys every resource.
+    void clear()
+    {
+        slots.clear();
+    }
+
+   private:
+    /// @brief Hands out the next ResourceID, shared by every resource type.
+    static ResourceID nextID()
+    {
+        static std::atomic<ResourceID> next{0};
+        const ResourceID id = next.fetch_add(1, std::memory_order_relaxed);
+        if (id >= MAX_RESOURCES) {
+            throw std::length_error("[Resources] Too many resource types");
+        }
+        return id;
+    }
+
+    /// @brief Type-erased owner of one resource.
+    struct IHolder
+    {
+        virtual ~IHolder() = default;
+    };
+
+    template <typename Resource>
+    struct Holder : IHolder
+    {
+        template <typename... Args>
+        explicit Holder(Args&&... args) : value(std::forward<Args>(args)...)
+        {
+        }
+
+        Resource value;
+    };
+
+    std::vector<std::unique_ptr<IHolder>>
+        slots;  ///< Resources, by ResourceID.
+};
@@ -0,0 +1,308 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "JobSystem.hpp"
+#include "Profiler.hpp"
+#include "System.hpp"
+#include "Types.hpp"
+
+class Registry;
+
+/**
+ * @struct SystemTiming
+ * @brief Time spent in one system during the last scheduled tick.
+ */
+struct SystemTiming
+{
+    SystemID id = 0;  ///< Identifier of the system.
+    std::string name;  ///< Name of the system.
+    size_t stage = 0;  ///< Stage the system ran in.
+    double milliseconds = 0.0;  ///< Duration of its update().
+};
+
+/**
+ * @struct TickTimings
+ * @brief Per-system and overall durations of the last scheduled tick.
+ */
+struct TickTimings
+{
+    /**
+     * @brief Returns the summed system time over the tick wall time, i.e.
+     * the average number of systems running at once.
+     */
+    double parallelism() const
+    {
+        double busy = 0.0;
+        for (const auto& system : systems) {
+            busy += system.milliseconds;
+        }
+        return milliseconds > 0.0 ? busy / milliseconds : 0.0;
+    }
+
+    std::vector<SystemTiming> systems;  ///< Enabled systems, in run order.
+    size_t stages = 0;  ///< Number of stages the systems were split into.
+    double milliseconds = 0.0;  ///< Wall time of the tick, flushes included.
+};
+
+/// @brief Writes one line per system followed by the tick summary.
+inline std::ostream& operator<<(std::ostream& os, const TickTimings& timings)
+{
+    for (const auto& system : timings.systems) {
+        os << "  [stage " << system.stage << "] " << system.name << ": "
+           << system.milliseconds << " ms\n";
+    }
+    return os << "  tick: " << timings.milliseconds << " ms over "
+              << timings.stages << " stages, parallelism "
+              << timings.parallelism() << "\n";
+}
+
+/**
+ * @class Scheduler
+ * @brief Runs the registry systems in stages of non-conflicting systems.
+ *
+ * Systems are visited in priority order. Each one is placed in the stage
+ * right after the last earlier system it conflicts with (see
+ * `SystemAccess::conflictsWith`), which keeps the dependency graph of a
+ * sequential update. The systems of a stage run concurrently on the
+ * `JobSystem`, and the command buffers are flushed between stages, so every
+ * system sees the same state as when running one after the other.
+ *
+ * With no worker thread, each system gets its own stage and the update is
+ * the plain sequential one.
+ *
+ * Schedulers left at the default worker count share one engine-wide
+ * `JobSystem` (see sharedJobs()), so a process running many registries
+ * starts one set of workers rather than one per registry.
+ *
+ * Every run() also feeds the `Profiler` when it is enabled.
+ */
+class Scheduler
+{
+   public:
+    /**
+     * @brief Creates a scheduler running its jobs on sharedJobs().
+     */
+    Scheduler() : workers(defaultWorkerCount()) {}
+
+    /// @brief Returns one worker per hardware thread beyond the caller.
+    static size_t defaultWorkerCount()
+    {
+        const unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 0;
+    }
+
+    /**
+     * @brief Returns the job system shared by every scheduler left at
+     * defaultWorkerCount() workers, starting it on first use.
+     */
+    static JobSystem& sharedJobs()
+    {
+        static JobSystem engineJobs(defaultWorkerCount());
+        return engineJobs;
+    }
+
+    /**
+     * @brief Sets the number of worker threads; 0 runs systems sequentially.
+     *
+     * Any count other than defaultWorkerCount() gives this scheduler its own
+     * `JobSystem`, whose threads are only started on the first use of
+     * jobs(). Must not be called while jobs are running.
+     */
+    void setWorkerCount(size_t count)
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        if (count != workers) {
+            pool.reset();
+        }
+        workers = count;
+        shared = count == defaultWorkerCount();
+    }
+
+    /// @brief Returns the number of worker threads.
+    size_t getWorkerCount() const
+    {
+        return workers;
+    }
+
+    /// @brief Returns the job system, starting its workers on first use.
+    JobSystem& jobs()
+    {
+        if (shared) {
+            return sharedJobs();
+        }
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        if (!pool) {
+            pool = std::make_unique<JobSystem>(workers);
+        }
+        return *pool;
+    }
+
+    /**
+     * @brief Returns the access of the system updating on the calling
+     * thread, or nullptr outside of a system update.
+     */
+    static const SystemAccess* runningAccess()
+    {
+        return runningSlot();
+    }
+
+    /// @brief Returns the timings of the last run().
+    const TickTimings& getTimings() const
+    {
+        return timings;
+    }
+
+    /// @brief Returns the profiler fed by run().
+    Profiler& profiler()
+    {
+        return profiling;
+    }
+
+    /// @brief Const version of profiler().
+    const Profiler& profiler() const
+    {
+        return profiling;
+    }
+
+    /**
+     * @brief Updates the enabled `systems` once, calling `flush()` after
+     * every stage.
+     * @param systems Systems sorted by priority.
+     * @param tick Tick of the step, as reported to the profiler.
+     */
+    template <typename Flush>
+    void run(
+        Registry& registry, const std::vector<std::unique_ptr<ISystem>>& systems,
+        float dt, uint64_t tick, Flush&& flush)
+    {
+        build(systems);
+        const auto start = std::chrono::steady_clock::now();
+#ifndef ECS_DISABLE_PROFILER
+        profiling.beginStep(tick, scheduled.size(), start);
+#else
+        (void)tick;
+#endif
+
+        for (size_t stage = 0; stage < timings.stages; ++stage) {
+            const size_t members = static_cast<size_t>(std::count(
+                stageOf.begin(), stageOf.end(), stage));
+
+            if (members == 1 || workers == 0) {
+                for (size_t i = 0; i < scheduled.size(); ++i) {
+                    if (stageOf[i] == stage) {
+                        runTimed(i, registry, dt);
+                    }
+                }
+            } else {
+                JobSystem& pool = jobs();
+                JobSystem::Counter counter;
+                for (size_t i = 0; i < scheduled.size(); ++i) {
+                    if (stageOf[i] == stage) {
+                        pool.submit(counter, [this, i, &registry, dt] {
+                            runTimed(i, registry, dt);
+                        });
+                    }
+                }
+                pool.wait(counter);
+            }
+            flush();
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        timings.milliseconds =
+            std::chrono::duration<double, std::milli>(end - start).count();
+#ifndef ECS_DISABLE_PROFILER
+        profiling.endStep(scheduled, end);
+#endif
+    }
+
+   private:
+    /// @brief Assigns a stage to every enabled system.
+    void build(const std::vector<std::unique_ptr<ISystem>>& systems)
+    {
+        scheduled.clear();
+        for (const auto& system : systems) {
+            if (system->enabled) {
+                scheduled.push_back(system.get());
+            }
+        }
+
+        stageOf.assign(scheduled.size(), 0);
+        timings.systems.resize(scheduled.size());
+        timings.stages = 0;
+
+        for (size_t j = 0; j < scheduled.size(); ++j) {
+            size_t stage = 0;
+            if (workers == 0) {
+                stage = j;
+            } else {
+                const SystemAccess& access = scheduled[j]->getAccess();
+                for (size_t i = 0; i < j; ++i) {
+                    if (stageOf[i] >= stage &&
+                        scheduled[i]->getAccess().conflictsWith(access)) {
+                        stage = stageOf[i] + 1;
+                    }
+                }
+            }
+            stageOf[j] = stage;
+            timings.stages = std::max(timings.stages, stage + 1);
+
+            SystemTiming& timing = timings.systems[j];
+            timing.id = scheduled[j]->getSystemID();
+            timing.name = scheduled[j]->getName();
+            timing.stage = stage;
+            timing.milliseconds = 0.0;
+        }
+    }
+
+    /// @brief Updates the `i`-th scheduled system and records its duration.
+    void runTimed(size_t i, Registry& registry, float dt)
+    {
+#ifndef ECS_DISABLE_PROFILER
+        const Profiler::Counters before = Profiler::counters();
+#endif
+        // Restored on exit: a thread waiting on jobs may run another system
+        struct Running
+        {
+            const SystemAccess* outer;
+            ~Running()
+            {
+                runningSlot() = outer;
+            }
+        } running{std::exchange(runningSlot(), &scheduled[i]->getAccess())};
+
+        const auto start = std::chrono::steady_clock::now();
+        scheduled[i]->update(registry, dt);
+        const auto end = std::chrono::steady_clock::now();
+        timings.systems[i].milliseconds =
+            std::chrono::duration<double, std::milli>(end - start).count();
+#ifndef ECS_DISABLE_PROFILER
+        profiling.recordSystem(i, start, end, Profiler::counters() - before);
+#endif
+    }
+
+    /// @brief Access of the system updating on this thread.
+    static const SystemAccess*& runningSlot()
+    {
+        thread_local const SystemAccess* access = nullptr;
+        return access;
+    }
+
+    size_t workers;  ///< Worker threads; 0 means sequential.
+    bool shared = true;  ///< Whether jobs() returns sharedJobs().
+    std::unique_ptr<JobSystem> pool;  ///< Own jobs, unless `shared`.
+    std::mutex jobsMutex;  ///< Guards the lazy start of `pool`.
+    std::vector<ISystem*> scheduled;  ///< Enabled systems, by priority.
+    std::vector<size_t> stageOf;  ///< Stage of each scheduled system.
+    TickTimings timings;  ///< Durations of the last run().
+    Profiler profiling;  ///< Optional per-system instrumentation.
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * @class Signal
+ * @brief List of listeners called, in connection order, by publish().
+ *
+ * connect() returns a connection ID to hand back to disconnect() once the
+ * listener goes away. Publishing a signal nobody listens to costs a single
+ * emptiness check.
+ *
+ * Listeners must not connect to or disconnect from the signal publishing
+ * them.
+ *
+ * @tparam Args Arguments passed to every listener.
+ */
+template <typename... Args>
+class Signal
+{
+   public:
+    /// @brief Callable invoked by publish().
+    using Listener = std::function<void(Args...)>;
+
+    /// @brief Identifies a connected listener.
+    using Connection = size_t;
+
+    /**
+     * @brief Adds `listener` after the ones already connected.
+     * @return ID to pass to disconnect().
+     */
+    Connection connect(Listener listener)
+    {
+        const Connection id = nextConnection++;
+        listeners.push_back({id, std::move(listener)});
+        return id;
+    }
+
+    /// @brief Removes the listener of `id`; unknown IDs are ignored.
+    void disconnect(Connection id)
+    {
+        listeners.erase(
+            std::remove_if(
+                listeners.begin(), listeners.end(),
+                [id](const Slot& slot) { return slot.id == id; }),
+            listeners.end());
+    }
+
+    /// @brief Checks whether no listener is connected.
+    bool empty() const
+    {
+        return listeners.empty();
+    }
+
+    /// @brief Returns the number of connected listeners.
+    size_t size() const
+    {
+        return listeners.size();
+    }
+
+    /// @brief Calls every listener with `args`.
+    void publish(Args... args) const
+    {
+        for (const Slot& slot : listeners) {
+            slot.listener(args...);
+        }
+    }
+
+   private:
+    /// @brief Listener and the ID it was connected under.
+    struct Slot
+    {
+        Connection id;
+        Listener listener;
+    };
+
+    std::vector<Slot> listeners;  ///< Connected listeners, oldest first.
+    Connection nextConnection = 0;  ///< ID given to the next listener.
+};
@@ -1,7 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
 #include <vector>
 
+#include "Component.hpp"
+#include "Types.hpp"
+
 /**
  * @class SparseSet
  * @brief Efficient associative container mapping entities to components.
@@ -16,14 +24,106 @@
  *
  * This layout ensures tight memory packing and cache-friendly iteration.
  *
+ * **Paged sparse index**: the sparse array is split into 4 KiB pages of
+ * 32-bit indices. A page is only allocated once an entity of its range gets a
+ * component, and is released as soon as its last entry is erased. A pool that
+ * only holds a few components therefore no longer pays for every entity ID
+ * ever issued.
+ *
+ * **Versioned entities**: only the slot index of a handle (see
+ * `ENTITY_INDEX_MASK`) addresses the sparse pages, so the index path is the
+ * same as with plain IDs. The dense array keeps full handles, and contains()
+ * compares against it so a stale handle whose slot was reused is not found.
+ *
+ * **Tags**: for an empty `Component` (see `isTagComponent`), the component
+ * array stays empty and only entity membership is stored, i.e. 4 bytes per
+ * entity. get() does not compile for a tag; iterations receive the shared
+ * instance returned by element() instead.
+ *
+ * **Change tracking**: once enableChangeTracking() is called, every
+ * component also carries the tick it was last written at (see touch()),
+ * stored in a third dense array kept in sync with the other two.
+ *
+ * **Allocator**: the dense arrays and the sparse pages are all taken from
+ * `Allocator` (rebound as needed), e.g. a `std::pmr::polymorphic_allocator`
+ * to place a pool in a dedicated memory resource.
+ *
  * @tparam Entity The entity identifier type (e.g. `uint32_t`).
  * @tparam Component The component type to store (e.g. `Transform`,
  * `RigidBody`).
+ * @tparam Allocator Allocator of `Component`, rebound for the other arrays.
  */
-template <typename Entity, typename Component>
+template <
+    typename Entity, typename Component,
+    typename Allocator = std::allocator<Component>>
 class SparseSet
 {
+    /// @brief Type of a sparse entry (index into the dense array).
+    using IndexType = uint32_t;
+
+    template <typename T>
+    using Rebind =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+    using IndexTraits = std::allocator_traits<Rebind<IndexType>>;
+
+    /// @brief One sparse page, owned by the set (null if not allocated).
+    using Page = IndexType*;
+
    public:
+    /// @brief Allocator the components are taken from.
+    using allocator_type = Allocator;
+
+    /// @brief Dense array of components.
+    using ComponentVector = std::vector<Component, Allocator>;
+
+    /// @brief Whether `Component` is a tag, stored without component array.
+    static constexpr bool isTag = isTagComponent<Component>;
+
+    SparseSet() = default;
+
+    /**
+     * @brief Creates an empty set taking all its memory from `allocator`.
+     */
+    explicit SparseSet(const Allocator& allocator)
+        : pages(Rebind<Page>(allocator)),
+          pageCounts(Rebind<IndexType>(allocator)),
+          dense(Rebind<Entity>(allocator)),
+          data(allocator),
+          ticks(Rebind<uint64_t>(allocator))
+    {
+    }
+
+    SparseSet(const SparseSet&) = delete;
+    SparseSet& operator=(const SparseSet&) = delete;
+
+    SparseSet(SparseSet&& other) noexcept
+        : pages(std::move(other.pages)),
+          pageCounts(std::move(other.pageCounts)),
+          dense(std::move(other.dense)),
+          data(std::move(other.data)),
+          ticks(std::move(other.ticks)),
+          tracking(other.tracking)
+    {
+        other.pages.clear();
+    }
+
+    ~SparseSet()
+    {
+        releasePages();
+    }
+
+    /// @brief Returns the allocator of the components.
+    allocator_type get_allocator() const
+    {
+        return data.get_allocator();
+    }
+
+    /// @brief Size in bytes of one sparse page.
+    static constexpr size_t PAGE_BYTES = 4096;
+
+    /// @brief Number of entity slots covered by one sparse page.
+    static constexpr size_t PAGE_SIZE = PAGE_BYTES / sizeof(IndexType);
+
     /**
      * @brief Checks if a given entity currently has an associated component.
      * @param e The entity to check.
@@ -31,7 +131,11 @@ class SparseSet
      */
     bool contains(Entity e) const
     {
-        return (e < sparse.size() && sparse[e] != npos);
+        const size_t page = pageOf(e);
+        if (page >= pages.size() || !pages[page])
+            return false;
+        const IndexType idx = pages[page][offsetOf(e)];
+        return idx != npos && dense[idx] == e;
     }
 
     /**
@@ -42,7 +146,8 @@ class SparseSet
      */
     Component& get(Entity e)
     {
-        return data[sparse[e]];
+        static_assert(!isTag, "Tag components hold no data, use contains()");
+        return data[indexOf(e)];
     }
 
     /**
@@ -50,7 +155,112 @@ class SparseSet
      */
     const Component& get(Entity e) const
     {
-        return data[sparse[e]];
+        static_assert(!isTag, "Tag components hold no data, use contains()");
+        return data[indexOf(e)];
+    }
+
+    /**
+     * @brief Returns what iterations hand out for `e`: get() for a data
+     * component, the shared instance of a tag (no lookup).
+     * @warning Undefined behavior if the entity does not have this component.
+     */
+    Component& element(Entity e)
+    {
+        if constexpr (isTag) {
+            (void)e;
+            return sharedTag();
+        } else {
+            return data[indexOf(e)];
+        }
+    }
+
+    /**
+     * @brief element() by position in the dense array.
+     */
+    Component& elementAt(size_t i)
+    {
+        if constexpr (isTag) {
+            (void)i;
+            return sharedTag();
+        } else {
+            return data[i];
+        }
+    }
+
+    /**
+     * @brief element() for iterations: stamps the component with `tick`
+     * first, unless `tick` is 0 or changes are not tracked.
+     * @warning Undefined behavior if the entity does not have this component.
+     */
+    Component& visit(Entity e, uint64_t tick)
+    {
+        return visitAt(indexOf(e), tick);
+    }
+
+    /// @brief visit() by dense index.
+    Component& visitAt(size_t i, uint64_t tick)
+    {
+        if (tick != 0 && tracking) {
+            ticks[i] = tick;
+        }
+        return elementAt(i);
+    }
+
+    /**
+     * @brief get() for writing: stamps the component with `tick` if changes
+     * are tracked.
+     * @warning Undefined behavior if the entity does not have this component.
+     */
+    Component& touch(Entity e, uint64_t tick)
+    {
+        const IndexType idx = indexOf(e);
+        if (tracking) {
+            ticks[idx] = tick;
+        }
+        return elementAt(idx);
+    }
+
+    /**
+     * @brief Starts recording the tick each component was last written at.
+     * @param tick Stamp given to the components already stored.
+     */
+    void enableChangeTracking(uint64_t tick)
+    {
+        if (!tracking) {
+            ticks.assign(dense.size(), tick);
+            tracking = true;
+        }
+    }
+
+    /// @brief Checks whether enableChangeTracking() was called.
+    bool tracksChanges() const
+    {
+        return tracking;
+    }
+
+    /**
+     * @brief Returns the tick `e` was last stamped at, or 0 if changes are
+     * not tracked.
+     * @warning Undefined behavior if the entity does not have this component.
+     */
+    uint64_t changedAt(Entity e) const
+    {
+        return tracking ? ticks[indexOf(e)] : 0;
+    }
+
+    /// @brief Stamps every stored component with `tick`.
+    void touchAll(uint64_t tick)
+    {
+        std::fill(ticks.begin(), ticks.end(), tick);
+    }
+
+    /**
+     * @brief Returns the stamps, in the order of the dense array (empty if
+     * changes are not tracked).
+     */
+    const std::vector<uint64_t, Rebind<uint64_t>>& changeTicks() const
+    {
+        return ticks;
     }
 
     /**
@@ -61,29 +271,41 @@ class SparseSet
      *
      * @tparam Args Constructor argument types for `Component`.
      * @param e The target entity.
-     * @param args Arguments forwarded to the component constructor.
+     * @param args Arguments forwarded to the component constructor (ignored
+     * for a tag, which is never constructed).
+     * @return Reference to the entity's component.
+     * @throws std::logic_error if the slot of `e` holds another generation
+     * of the same index.
      */
     template <typename... Args>
-    void emplace(Entity e, Args&&... args)
+    Component& emplace(Entity e, Args&&... args)
     {
-        // Resize sparse vector if needed to accommodate entity ID
-        if (e >= sparse.size()) {
-            sparse.resize(e + 1, npos);
+        IndexType& slot = assureSlot(e);
+        if (slot != npos && dense[slot] != e) {
+            throw std::logic_error(
+                "[SparseSet] emplace() on a slot held by another generation");
         }
 
         // Only add if the entity doesn't already have this component
-        if (!contains(e)) {
-            sparse[e] = dense.size();
+        if (slot == npos) {
+            slot = static_cast<IndexType>(dense.size());
+            pageCounts[pageOf(e)]++;
             dense.push_back(e);
-            data.emplace_back(std::forward<Args>(args)...);
+            if constexpr (!isTag) {
+                data.emplace_back(std::forward<Args>(args)...);
+            }
+            if (tracking) {
+                ticks.push_back(0);
+            }
         }
+        return elementAt(slot);
     }
 
     /**
      * @brief Removes the component associated with an entity.
      *
      * Maintains array compactness by moving the last element into the erased
-     * position.
+     * position. The sparse page of `e` is released once it becomes empty.
      *
      * @param e Entity whose component to remove.
      */
@@ -92,19 +314,64 @@ class SparseSet
         if (!contains(e))
             return;
 
-        size_t idx = sparse[e];
+        const size_t page = pageOf(e);
+        IndexType idx = pages[page][offsetOf(e)];
         size_t last = dense.size() - 1;
 
         // Move the last element to the erased spot for contiguous storage
         Entity movedEntity = dense[last];
         dense[idx] = movedEntity;
-        data[idx] = std::move(data[last]);
-        sparse[movedEntity] = idx;
+        if constexpr (!isTag) {
+            data[idx] = std::move(data[last]);
+            data.pop_back();
+        }
+        pages[pageOf(movedEntity)][offsetOf(movedEntity)] = idx;
+        if (tracking) {
+            ticks[idx] = ticks[last];
+            ticks.pop_back();
+        }
 
         // Pop the last (now moved) element
         dense.pop_back();
-        data.pop_back();
-        sparse[e] = npos;
+        pages[page][offsetOf(e)] = npos;
+
+        if (--pageCounts[page] == 0) {
+            freePage(page);
+        }
+    }
+
+    /**
+     * @brief Returns the position of an entity in the dense array.
+     * @warning Undefined behavior if the entity does not have this component.
+     */
+    size_t index(Entity e) const
+    {
+        return indexOf(e);
+    }
+
+    /**
+     * @brief Swaps two dense positions, keeping the sparse index coherent.
+     *
+     * Used by groups to pack their members at the front of the pool.
+     * @param lhs First dense position.
+     * @param rhs Second dense position.
+     */
+    void swapAt(size_t lhs, size_t rhs)
+    {
+        if (lhs == rhs)
+            return;
+
+        const Entity a = dense[lhs];
+        const Entity b = dense[rhs];
+        std::swap(dense[lhs], dense[rhs]);
+        if constexpr (!isTag) {
+            std::swap(data[lhs], data[rhs]);
+        }
+        if (tracking) {
+            std::swap(ticks[lhs], ticks[rhs]);
+        }
+        pages[pageOf(a)][offsetOf(a)] = static_cast<IndexType>(rhs);
+        pages[pageOf(b)][offsetOf(b)] = static_cast<IndexType>(lhs);
     }
 
     /**
@@ -116,7 +383,12 @@ class SparseSet
     void reserve(size_t capacity)
     {
         dense.reserve(capacity);
-        data.reserve(capacity);
+        if constexpr (!isTag) {
+            data.reserve(capacity);
+        }
+        if (tracking) {
+            ticks.reserve(capacity);
+        }
     }
 
     /**
@@ -124,9 +396,12 @@ class SparseSet
      */
     void clear()
     {
-        sparse.clear();
+        releasePages();
+        pages.clear();
+        pageCounts.clear();
         dense.clear();
         data.clear();
+        ticks.clear();
     }
 
     /**
@@ -138,6 +413,15 @@ class SparseSet
         return dense.size();
     }
 
+    /**
+     * @brief Returns the number of components the set can hold before it
+     * reallocates.
+     */
+    size_t capacity() const
+    {
+        return dense.capacity();
+    }
+
     /**
      * @brief Checks if the set is empty (no components).
      * @return True if empty, false otherwise.
@@ -147,6 +431,35 @@ class SparseSet
         return dense.empty();
     }
 
+    /**
+     * @brief Returns the number of sparse pages currently allocated.
+     */
+    size_t pageCount() const
+    {
+        size_t count = 0;
+        for (const auto& page : pages) {
+            if (page) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Returns the heap memory held by this set, in bytes.
+     *
+     * Accounts for the sparse page table, the allocated pages and the
+     * capacity of the dense entity and component arrays.
+     */
+    size_t memoryUsage() const
+    {
+        return pages.capacity() * sizeof(Page) +
+               pageCounts.capacity() * sizeof(IndexType) +
+               pageCount() * PAGE_BYTES + dense.capacity() * sizeof(Entity) +
+               data.capacity() * sizeof(Component) +
+               ticks.capacity() * sizeof(uint64_t);
+    }
+
     /// @brief Iterator access (begin) — iterates over entity IDs.
     auto begin()
     {
@@ -173,9 +486,10 @@ class SparseSet
 
     /**
      * @brief Returns a reference to the internal component vector.
-     * @return Reference to the vector of components.
+     * @return Reference to the vector of components (always empty for a
+     * tag).
      */
-    std::vector<Component>& components()
+    ComponentVector& components()
     {
         return data;
     }
@@ -183,22 +497,95 @@ class SparseSet
     /**
      * @brief Const version of components().
      */
-    const std::vector<Component>& components() const
+    const ComponentVector& components() const
     {
         return data;
     }
 
    private:
     /// @brief Sentinel value indicating that an entity has no component entry.
-    static constexpr size_t npos = static_cast<size_t>(-1);
+    static constexpr IndexType npos = static_cast<IndexType>(-1);
+
+    /// @brief Instance of a tag handed out by element().
+    static Component& sharedTag()
+    {
+        static Component instance;
+        return instance;
+    }
+
+    /// @brief Returns the sparse page covering entity `e`.
+    static size_t pageOf(Entity e)
+    {
+        return (static_cast<size_t>(e) & ENTITY_INDEX_MASK) / PAGE_SIZE;
+    }
+
+    /// @brief Returns the slot of entity `e` inside its sparse page.
+    static size_t offsetOf(Entity e)
+    {
+        return (static_cast<size_t>(e) & ENTITY_INDEX_MASK) % PAGE_SIZE;
+    }
+
+    /// @brief Returns the dense index of an entity known to be present.
+    IndexType indexOf(Entity e) const
+    {
+        return pages[pageOf(e)][offsetOf(e)];
+    }
+
+    /**
+     * @brief Returns the sparse slot of `e`, allocating its page if needed.
+     */
+    IndexType& assureSlot(Entity e)
+    {
+        const size_t page = pageOf(e);
+
+        if (page >= pages.size()) {
+            pages.resize(page + 1);
+            pageCounts.resize(page + 1, 0);
+        }
 
-    /// @brief Maps entity IDs → indices in the dense array.
-    std::vector<size_t> sparse;
+        if (!pages[page]) {
+            Rebind<IndexType> allocator(data.get_allocator());
+            pages[page] = IndexTraits::allocate(allocator, PAGE_SIZE);
+            std::fill_n(pages[page], PAGE_SIZE, npos);
+        }
+
+        return pages[page][offsetOf(e)];
+    }
+
+    /// @brief Returns sparse page `page` to the allocator.
+    void freePage(size_t page)
+    {
+        Rebind<IndexType> allocator(data.get_allocator());
+        IndexTraits::deallocate(allocator, pages[page], PAGE_SIZE);
+        pages[page] = nullptr;
+    }
+
+    /// @brief Returns every sparse page to the allocator.
+    void releasePages()
+    {
+        for (size_t page = 0; page < pages.size(); ++page) {
+            if (pages[page]) {
+                freePage(page);
+            }
+        }
+    }
+
+    /// @brief Sparse pages mapping entity IDs → indices in the dense array.
+    std::vector<Page, Rebind<Page>> pages;
+
+    /// @brief Number of live entries in each sparse page.
+    std::vector<IndexType, Rebind<IndexType>> pageCounts;
 
     /// @brief Stores all entity IDs that currently have this component type.
-    std::vector<Entity> dense;
+    std::vector<Entity, Rebind<Entity>> dense;
 
     /// @brief Stores component data in the same order as `dense` for fast
     /// iteration.
-    std::vector<Component> data;
+    ComponentVector data;
+
+    /// @brief Tick each component was last written at, in `dense` order.
+    std::vector<uint64_t, Rebind<uint64_t>> ticks;
+
+    /// @brief Whether `ticks` is maintained.
+    bool tracking = false;
 };
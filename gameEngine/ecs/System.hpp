@@ -4,10 +4,52 @@
 #include <vector>
 
 #include "ComponentRegistry.hpp"
+#include "Resources.hpp"
 #include "Types.hpp"
 
 class Registry;
 
+/**
+ * @struct SystemAccess
+ * @brief Component types a system reads and writes during its update.
+ *
+ * The `Registry` runs two systems concurrently only if neither writes what
+ * the other touches. Components emplaced or removed through the command
+ * buffer count as writes, since later systems see them after the flush.
+ * A system that never declares its access conflicts with every other one.
+ */
+struct SystemAccess
+{
+    /**
+     * @brief Checks whether two systems must not run at the same time.
+     *
+     * Two systems that create or destroy entities always conflict, so
+     * entity IDs are handed out in the same order as a sequential update.
+     */
+    bool conflictsWith(const SystemAccess& other) const
+    {
+        if (!declared || !other.declared) {
+            return true;
+        }
+        if (structural && other.structural) {
+            return true;
+        }
+        return (writes & (other.reads | other.writes)).any() ||
+               (other.writes & reads).any() ||
+               (resourceWrites &
+                (other.resourceReads | other.resourceWrites))
+                   .any() ||
+               (other.resourceWrites & resourceReads).any();
+    }
+
+    ComponentSignature reads;  ///< Component types only read.
+    ComponentSignature writes;  ///< Component types modified or emplaced.
+    ResourceSignature resourceReads;  ///< Resource types only read.
+    ResourceSignature resourceWrites;  ///< Resource types modified.
+    bool structural = false;  ///< Creates or destroys entities.
+    bool declared = false;  ///< Whether the fields above were filled in.
+};
+
 /**
  * @class ISystem
  * @brief Base interface for all systems within the ECS framework.
@@ -57,12 +99,37 @@ class ISystem
      */
     virtual const std::string& getName() const = 0;
 
+    /**
+     * @brief Returns the components the system reads and writes.
+     *
+     * Systems that do not override it run alone.
+     */
+    virtual const SystemAccess& getAccess() const
+    {
+        static const SystemAccess exclusive;
+        return exclusive;
+    }
+
     /**
      * @brief Assigns a unique system ID (usually handled by the `Registry`).
      * @param id New system ID.
      */
     virtual void setSystemID(SystemID id) = 0;
 
+    /**
+     * @brief Called by the `Registry` right after the system is added to it.
+     *
+     * Event-driven systems connect their listeners here (see
+     * `Registry::onConstruct()`).
+     */
+    virtual void onAttach(Registry&) {}
+
+    /**
+     * @brief Called by the `Registry` before the system is removed from it;
+     * disconnects what onAttach() connected.
+     */
+    virtual void onDetach(Registry&) {}
+
     /// @brief Determines update order (higher priority systems run earlier).
     int priority = 0;
 
@@ -85,12 +152,17 @@ class ISystem
  * void onUpdate(Registry& registry, float dt);
  * ```
  *
+ * Declaring what `onUpdate` reads and writes lets the `Registry` run the
+ * system concurrently with the ones it does not conflict with (see
+ * `SystemAccess`). Required components are implicitly read.
+ *
  * Example usage:
  * ```cpp
  * class MovementSystem : public System<MovementSystem> {
  * public:
  *     MovementSystem() {
  *         requireComponents<Transform, Velocity>();
+ *         writeComponents<Transform>();
  *     }
  *     void onUpdate(Registry& registry, float dt);
  * };
@@ -126,6 +198,15 @@ class System : public ISystem
         return signature;
     }
 
+    /**
+     * @brief Returns the declared access, with the required components
+     * counted as reads.
+     */
+    const SystemAccess& getAccess() const override
+    {
+        return access;
+    }
+
     /**
      * @brief Returns the system’s unique identifier.
      */
@@ -176,9 +257,8 @@ class System : public ISystem
     void requireComponents()
     {
         signature.reset();
-        (signature.set(
-             ComponentRegistry::instance().getOrCreateID<Components>()),
-         ...);
+        (signature.set(ComponentRegistry::typeID<Components>()), ...);
+        access.reads |= signature;
     }
 
     /**
@@ -198,6 +278,57 @@ class System : public ISystem
                 signature.set(id);
             }
         }
+        access.reads |= signature;
+    }
+
+    /**
+     * @brief Declares components read by the system beyond the required ones.
+     */
+    template <typename... Components>
+    void readComponents()
+    {
+        (access.reads.set(ComponentRegistry::typeID<Components>()), ...);
+        access.declared = true;
+    }
+
+    /**
+     * @brief Declares components the system modifies, or emplaces and
+     * removes through the command buffer.
+     */
+    template <typename... Components>
+    void writeComponents()
+    {
+        (access.writes.set(ComponentRegistry::typeID<Components>()), ...);
+        access.declared = true;
+    }
+
+    /**
+     * @brief Declares resources (see `Resources`) the system only reads.
+     */
+    template <typename... ResourceTypes>
+    void readResources()
+    {
+        (access.resourceReads.set(Resources::typeID<ResourceTypes>()), ...);
+        access.declared = true;
+    }
+
+    /**
+     * @brief Declares resources (see `Resources`) the system modifies.
+     */
+    template <typename... ResourceTypes>
+    void writeResources()
+    {
+        (access.resourceWrites.set(Resources::typeID<ResourceTypes>()), ...);
+        access.declared = true;
+    }
+
+    /**
+     * @brief Declares that the system creates or destroys entities.
+     */
+    void changeEntities()
+    {
+        access.structural = true;
+        access.declared = true;
     }
 
    private:
@@ -205,6 +336,9 @@ class System : public ISystem
     /// this system.
     ComponentSignature signature;
 
+    /// @brief Components read and written by onUpdate().
+    SystemAccess access;
+
     /// @brief System’s unique identifier (assigned by the registry).
     SystemID systemID = 0;
 
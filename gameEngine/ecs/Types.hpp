@@ -1,6 +1,7 @@
 #pragma once
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 
 /**
@@ -31,6 +32,25 @@ using ComponentID = uint32_t;
  */
 using SystemID = uint32_t;
 
+/**
+ * @def ENTITY_INDEX_BITS
+ * @brief Number of low bits of an entity handle holding its slot index.
+ *
+ * The remaining high bits hold the generation of the slot, bumped every time
+ * an entity using it is destroyed, so a handle kept past the destruction of
+ * its entity no longer matches the slot once it is reused.
+ */
+constexpr uint32_t ENTITY_INDEX_BITS = 24;
+
+/**
+ * @def ENTITY_INDEX_MASK
+ * @brief Mask extracting the slot index of an entity handle.
+ *
+ * Dense per-entity tables (sparse pages, signatures, archetype locations) are
+ * indexed by `handle & ENTITY_INDEX_MASK`.
+ */
+constexpr uint32_t ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+
 /**
  * @def MAX_COMPONENTS
  * @brief Maximum number of distinct component types supported by the ECS.
@@ -56,3 +76,57 @@ constexpr size_t MAX_COMPONENTS = 128;
  * ```
  */
 using ComponentSignature = std::bitset<MAX_COMPONENTS>;
+
+/**
+ * @typedef ResourceID
+ * @brief Unique identifier for each resource type (see `Resources`).
+ *
+ * Counted apart from `ComponentID`, so resources do not use up component
+ * signature bits.
+ */
+using ResourceID = uint32_t;
+
+/**
+ * @def MAX_RESOURCES
+ * @brief Maximum number of distinct resource types supported by the ECS.
+ */
+constexpr size_t MAX_RESOURCES = 64;
+
+/**
+ * @typedef ResourceSignature
+ * @brief Bitset representing which resources a system reads or writes.
+ */
+using ResourceSignature = std::bitset<MAX_RESOURCES>;
+
+/**
+ * @brief Calls `func(ComponentID)` for every bit set in `signature`.
+ *
+ * Walks the signature one 64-bit word at a time and jumps straight to the set
+ * bits, so the cost follows the number of components rather than
+ * MAX_COMPONENTS.
+ */
+template <typename Func>
+inline void forEachComponent(const ComponentSignature& signature, Func&& func)
+{
+    static_assert(MAX_COMPONENTS % 64 == 0, "Signature must be whole words");
+    constexpr ComponentSignature wordMask(~0ULL);
+
+    if (signature.none())
+        return;
+
+    for (size_t word = 0; word < MAX_COMPONENTS / 64; ++word) {
+        uint64_t bits = ((signature >> (word * 64)) & wordMask).to_ullong();
+        while (bits != 0) {
+#if defined(__GNUC__) || defined(__clang__)
+            const size_t bit = static_cast<size_t>(__builtin_ctzll(bits));
+#else
+            size_t bit = 0;
+            while (((bits >> bit) & 1ULL) == 0) {
+                bit++;
+            }
+#endif
+            func(static_cast<ComponentID>(word * 64 + bit));
+            bits &= bits - 1;
+        }
+    }
+}
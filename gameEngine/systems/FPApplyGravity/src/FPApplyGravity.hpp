@@ -59,6 +59,7 @@ class FPApplyGravity : public System<FPApplyGravity>
         requireComponents<
             GameEngine::Acceleration, GameEngine::Gravity,
             GameEngine::InputControlled>();
+        writeComponents<GameEngine::Acceleration>();
     }
 
     /**
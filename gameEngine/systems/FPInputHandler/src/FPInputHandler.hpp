@@ -81,6 +81,7 @@ class FPInputHandler : public System<FPInputHandler>
     FPInputHandler()
     {
         requireComponents<GameEngine::InputControlled, GameEngine::Velocity>();
+        writeComponents<GameEngine::InputControlled, GameEngine::Velocity>();
     }
 
     /**
@@ -38,7 +38,7 @@ namespace GameEngine {
  *
  * 3. **Position Update Phase**: Translates entity position by velocity
  *    - Position clamped to screen bounds: [0, screenSize]
- *    - Uses Renderable component for screen dimensions
+ *    - Uses the Viewport resource for screen dimensions
  *
  * **Deceleration Formula:**
  * ```
@@ -51,7 +51,8 @@ namespace GameEngine {
  * - Position: Current location to update
  * - Velocity: Current movement speed with speedMax limit
  * - Acceleration: Forces to apply
- * - Renderable: Screen size for boundary constraints
+ * - Renderable: Only rendered entities move
+ * - Viewport (resource): Screen size for boundary constraints
  *
  * @performance
  * - Time Complexity: O(n) where n is number of moving entities
@@ -73,7 +74,7 @@ class FPMotion : public System<FPMotion>
      * - Position: Entity location
      * - Velocity: Current movement speed
      * - Acceleration: Force to apply
-     * - Renderable: Screen boundary information
+     * - Viewport (resource): Screen boundary information
      *
      * The system only processes entities with all four components.
      *
@@ -84,6 +85,8 @@ class FPMotion : public System<FPMotion>
         requireComponents<
             GameEngine::Position, GameEngine::Velocity,
             GameEngine::Acceleration, GameEngine::Renderable>();
+        writeComponents<GameEngine::Position, GameEngine::Velocity>();
+        readResources<GameEngine::Viewport>();
     }
 
     /**
@@ -106,7 +109,7 @@ class FPMotion : public System<FPMotion>
      *
      * **Phase 3: Position Update (Movement)**
      * - Translates position by velocity amount
-     * - Clamps position to screen bounds using Renderable dimensions
+     * - Clamps position to screen bounds using the Viewport resource
      * - Ensures entities never leave the visible play area
      *
      * @param registry Reference to the ECS Registry (unused but required by
@@ -126,9 +129,9 @@ class FPMotion : public System<FPMotion>
      * - Prevents physics simulation instability
      *
      * **Boundary Constraints:**
-     * - Screen position: [0, screenSizeX] and [0, screenSizeY]
+     * - Screen position: [0, width] and [0, height] of the Viewport
      * - Entities cannot move beyond screen edges
-     * - Uses Renderable component for screen resolution
+     * - Falls back to a default Viewport when the world has none
      *
      * @attention
      * - Deceleration applies EVERY frame, not just when no input
@@ -162,11 +165,13 @@ class FPMotion : public System<FPMotion>
     void onUpdate(Registry& registry, float dt)
     {
         updateCount++;
+        const Viewport* found = registry.resources().find<Viewport>();
+        const Viewport viewport = found ? *found : Viewport{};
 
         registry.each<Position, Velocity, Acceleration, Renderable>(
-            [dt](
+            [dt, viewport](
                 auto e, Position& pos, Velocity& vel, Acceleration& acc,
-                Renderable& render) {
+                Renderable&) {
                 // Phase 2: Acceleration (apply forces and clamp to speed limit)
                 vel.x = std::clamp(
                     vel.x + (acc.x * dt), -vel.speedMax, vel.speedMax);
@@ -176,9 +181,9 @@ class FPMotion : public System<FPMotion>
                 // Phase 3: Position update (translate and constrain to screen
                 // bounds)
                 pos.pos.x = std::clamp(
-                    pos.pos.x + (vel.x * dt), float(0), render.screenSizeX);
+                    pos.pos.x + (vel.x * dt), float(0), viewport.width);
                 pos.pos.y = std::clamp(
-                    pos.pos.y + (vel.y * dt), float(0), render.screenSizeY);
+                    pos.pos.y + (vel.y * dt), float(0), viewport.height);
             });
     }
 
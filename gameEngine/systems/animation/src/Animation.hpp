@@ -1,9 +1,12 @@
 #pragma once
 
-#include <chrono>
-#include <ratio>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
 
 #include "../../../components/renderable/src/Renderable.hpp"
+#include "../../../ecs/EntityManager.hpp"
 #include "../../../ecs/Registry.hpp"
 #include "../../../ecs/System.hpp"
 
@@ -14,50 +17,63 @@ namespace GameEngine {
  * rectangles.
  *
  * The Animation system handles frame-based sprite animations by:
- * 1. **Timing**: Tracks elapsed time since system initialization
- * 2. **Frame calculation**: Determines current animation frame based on time
- * 3. **Rect updates**: Updates the Renderable component's current texture
- * rectangle
+ * 1. **Timing**: Counts the fixed steps of the `GameClock` since each entity
+ * started its animation
+ * 2. **Scheduling**: Queues each animated entity for the tick its frame
+ * changes at
+ * 3. **Frame updates**: Patches the Renderable component's frame index of
+ * the entities due
  *
- * This enables smooth sprite animations without per-entity timers.
+ * Only entities whose frame changes are touched: single-frame sprites are
+ * never queued, and a 500ms animation at 120 Hz is visited once every 60
+ * steps.
  *
  * @details
- * **Animation Pipeline (per frame):**
- * 1. **Time Calculation**: Computes milliseconds since system start
- * 2. **Frame Selection**: Uses modulo arithmetic to cycle through frames
- * 3. **Rect Update**: Sets currentRectPos to the appropriate frame
+ * **Animation Pipeline (per fixed step):**
+ * 1. **Start**: Entities given a Renderable since the last step are queued
+ * 2. **Due entities**: Entities whose frame-change tick is reached are popped
+ * 3. **Frame Update**: Their frame is advanced through Registry::patch() and
+ * their next frame-change tick is queued
  *
  * **Frame Selection Formula:**
  * ```
- * frameIndex = (elapsedMs / frameDuration) % totalFrames
+ * frame = (firstFrame + elapsedMs / frameDuration) % totalFrames
+ * elapsedMs = (tick - startTick) * fixedDeltaTime
  * ```
  * This creates a looping animation that repeats indefinitely.
  *
  * **Timing Behavior:**
- * - All entities share the same time reference (startPoint)
- * - Synchronizes animations across multiple entities
+ * - Driven by simulation ticks: deterministic, and paused with the clock
+ * - Each entity starts its animation on the step after it got a Renderable
  * - Frame duration determines animation speed (ms per frame)
  *
+ * **Change Reporting:**
+ * - Frames are written with Registry::patch(): onUpdate<Renderable>()
+ * listeners are notified, and when `registry.trackChanges<Renderable>()` is
+ * on, `registry.changed<Renderable>(since)` lists the frames to resend
+ *
  * @requires
- * - Renderable: Must contain non-empty rectPos vector for animation frames
- * - frameDuration: Must be set to control animation speed
+ * - Renderable: Its animation must have frames in the AssetRegistry
+ * - frameDuration: Must be set in the animation to control its speed
  *
  * @performance
- * - Time Complexity: O(n) where n is number of animated entities
+ * - Time Complexity: O(c) per step, c entities changing frame: entities are
+ * bucketed by due tick in a timing wheel
  * - Space Complexity: O(1) per entity
- * - Single time query per frame for all entities
  *
  * @note
- * - Entities with empty rectPos vectors are skipped
- * - All animations start synchronized at system creation
+ * - Entities whose animation has less than two frames are never queued
  * - Frame duration is in milliseconds
+ * - Switching the animation of a Renderable keeps its timing; emplace a new
+ * Renderable to restart it
  *
  * @example
  * ```cpp
- * // Entity with 4 animation frames, 100ms per frame
- * // rectPos = [rect0, rect1, rect2, rect3]
+ * // Entity with 4 animation frames, 100ms per frame, at 120 Hz
+ * // frames = [rect0, rect1, rect2, rect3]
  * // frameDuration = 100
- * // At 250ms: frame = (250 / 100) % 4 = 2 → displays rect2
+ * // 30 ticks after start (250ms): frame = (250 / 100) % 4 = 2 → rect2
+ * // Next visit at tick 36 (300ms), for frame 3
  * ```
  *
  * @see Renderable
@@ -65,21 +81,6 @@ namespace GameEngine {
  */
 class Animation : public System<Animation>
 {
-   private:
-    /**
-     * @brief Time point marking system initialization.
-     *
-     * Used as reference point for calculating elapsed time.
-     * Set once during construction and never reset.
-     *
-     * @details Uses steady_clock for monotonic time measurement,
-     * immune to system clock adjustments.
-     */
-    std::chrono::time_point<
-        std::chrono::steady_clock,
-        std::chrono::duration<long, std::ratio<1, 1000000000>>>
-        startPoint = std::chrono::steady_clock::now();
-
    public:
     /**
      * @brief Constructs the Animation system and declares component
@@ -93,72 +94,118 @@ class Animation : public System<Animation>
     Animation()
     {
         requireComponents<GameEngine::Renderable>();
+        writeComponents<GameEngine::Renderable>();
+        readResources<GameEngine::AssetRegistry>();
     }
 
     /**
-     * @brief Updates all entity animations based on elapsed time.
-     *
-     * Processes each entity with a Renderable component:
+     * @brief Queues the entities that already have a Renderable, and starts
+     * listening for new ones.
+     */
+    void onAttach(Registry& registry) override
+    {
+        registry.each<Renderable>(
+            [this](auto e, Renderable&) { started.push_back(e); });
+        constructed = registry.onConstruct<Renderable>().connect(
+            [this](Registry&, EntityManager::Entity e) {
+                started.push_back(e);
+            });
+    }
+
+    /// @brief Disconnects the listener of onAttach().
+    void onDetach(Registry& registry) override
+    {
+        registry.onConstruct<Renderable>().disconnect(constructed);
+    }
+
+    /**
+     * @brief Advances the animations whose frame changes at the current
+     * tick.
      *
-     * **Time Calculation:**
-     * - Computes time delta from system initialization
-     * - Converts to milliseconds for frame indexing
+     * **Start:**
+     * - Entities queued since the last step start at the current tick, from
+     *   the frame their Renderable was created with
      *
      * **Frame Selection:**
-     * - Divides elapsed time by frame duration
-     * - Uses modulo to wrap around frame count
-     * - Updates currentRectPos with selected frame
+     * - Pops every entity due at or before `registry.tick()`
+     * - Computes its frame from the ticks elapsed since its start
+     * - Patches Renderable::frame and queues the next frame change
      *
      * **Safety Check:**
-     * - Skips entities with empty rectPos vectors
-     * - Prevents division by zero and invalid access
-     *
-     * @param registry Reference to the ECS Registry (unused but required by
-     * interface).
-     * @param dt Delta time since last update in seconds (unused in current
-     * implementation).
-     *
-     * @details
-     * **Frame Timing:**
-     * - frameDuration is in milliseconds
-     * - Lower values = faster animation
-     * - Example: 100ms = 10 FPS, 50ms = 20 FPS
-     *
-     * **Synchronization:**
-     * - All entities use same time reference
-     * - Animations start in sync at system creation
-     * - To desync, use per-entity time offsets
+     * - Skips destroyed entities and entities that lost their Renderable
+     * - Drops entities whose animation has less than two frames or no
+     *   duration
      *
-     * @attention
-     * - Entities without rectPos frames are silently skipped
-     * - Frame duration must be > 0 to avoid division by zero
-     * - Animation loops infinitely; no stop mechanism
+     * @param registry Reference to the ECS Registry, whose AssetRegistry
+     * holds the frame tables.
+     * @param dt Delta time since last update in seconds (unused: timing
+     * comes from the registry tick and the fixed step of its clock).
      *
-     * @example
-     * ```cpp
-     * // Walking animation: 8 frames, 80ms per frame
-     * // Total loop time: 8 * 80ms = 640ms
-     * // At 1000ms: frame = (1000 / 80) % 8 = 4
-     * ```
-     *
-     * @see Registry::each
+     * @see Registry::patch
      * @see Renderable
      */
     void onUpdate(Registry& registry, float dt)
     {
         updateCount++;
-        auto currentTimePoint = std::chrono::steady_clock::now();
-        auto deltaTime = currentTimePoint - startPoint;
-
-        registry.each<Renderable>([dt, deltaTime](auto e, Renderable& render) {
-            if (render.rectPos.size() != 0)
-                render.currentRectPos =
-                    render.rectPos
-                        [std::chrono::duration_cast<std::chrono::milliseconds>(
-                             deltaTime)
-                             .count() /
-                         render.frameDuration % render.rectPos.size()];
-        });
+        const AssetRegistry* assets =
+            registry.resources().find<AssetRegistry>();
+        if (!assets)
+            return;
+
+        const uint64_t now = registry.tick();
+        const uint64_t tickNs = std::max<uint64_t>(
+            1, std::llround(registry.getClock().getFixedDeltaTime() * 1e9));
+
+        const Registry& reader = registry;
+        for (EntityManager::Entity e : started) {
+            if (!reader.has<Renderable>(e))
+                continue;
+            const uint32_t index = EntityManager::indexOf(e);
+            if (index >= tracks.size()) {
+                tracks.resize(index + 1);
+            }
+            const Renderable& render = reader.get<Renderable>(e);
+            Track& track = tracks[index];
+            track.entity = e;
+            track.start = now;
+            track.firstFrame = render.frame;
+            load(track, assets->animation(render.animation), render.animation);
+            schedule(track, 0, tickNs);
+        }
+        started.clear();
+
+        // Buckets of the ticks since the last update, a lap at most
+        uint64_t first = lastTick + 1;
+        if (now >= WHEEL_SIZE) {
+            first = std::max(first, now + 1 - WHEEL_SIZE);
+        }
+        for (uint64_t tick = first; tick <= now; ++tick) {
+            bucket.swap(wheel[tick & WHEEL_MASK]);
+            for (const Due& next : bucket) {
+                Track& track = tracks[EntityManager::indexOf(next.entity)];
+                if (track.entity != next.entity || track.due != next.tick ||
+                    !reader.has<Renderable>(next.entity))
+                    continue;
+                if (next.tick > now) {
+                    // More than a lap ahead
+                    wheel[next.tick & WHEEL_MASK].push_back(next);
+                    continue;
+                }
+                advance(registry, *assets, track, now, tickNs);
+            }
+            bucket.clear();
+        }
+        lastTick = std::max(lastTick, now);
+    }
+
+    /// @brief Returns the number of entities waiting for a frame change.
+    size_t scheduled() const
+    {
+        size_t count = 0;
+        for (const Track& track : tracks) {
+            count += track.due != 0;
+        }
+        return count;
     }
 
     /**
@@ -173,5 +220,89 @@ class Animation : public System<Animation>
      * needed for testing.
      */
     int updateCount = 0;
+
+   private:
+    /// @brief Ticks covered by the wheel; later frame changes wait laps.
+    static constexpr uint64_t WHEEL_SIZE = 256;
+    static constexpr uint64_t WHEEL_MASK = WHEEL_SIZE - 1;
+
+    /// @brief Animation state of one entity slot.
+    struct Track
+    {
+        EntityManager::Entity entity =
+            EntityManager::INVALID_ENTITY;  ///< Current owner of the slot.
+        uint64_t start = 0;  ///< Tick the animation started at.
+        uint64_t due = 0;    ///< Tick of the next frame change, 0 if none.
+        uint64_t frameNs = 0;     ///< Frame duration, in nanoseconds.
+        AnimationID animation = 0;  ///< Animation `frameNs` comes from.
+        uint16_t frames = 0;        ///< Frame count of `animation`.
+        uint16_t firstFrame = 0;    ///< Frame shown at `start`.
+    };
+
+    /// @brief Queued frame change; stale once the track moved on.
+    struct Due
+    {
+        uint64_t tick;
+        EntityManager::Entity entity;
+    };
+
+    /// @brief Caches the timing of `animation` (interned as `id`) in `track`.
+    static void load(
+        Track& track, const SpriteAnimation& animation, AnimationID id)
+    {
+        track.animation = id;
+        track.frames = static_cast<uint16_t>(animation.frames.size());
+        track.frameNs = animation.frameDuration > 0
+                            ? uint64_t(animation.frameDuration) * 1000000
+                            : 0;
+    }
+
+    /**
+     * @brief Patches the frame of a due `track` and queues its next change.
+     */
+    void advance(
+        Registry& registry, const AssetRegistry& assets, Track& track,
+        uint64_t now, uint64_t tickNs)
+    {
+        uint64_t elapsed = 0;
+        registry.patch<Renderable>(track.entity, [&](Renderable& render) {
+            if (render.animation != track.animation) {
+                load(track, assets.animation(render.animation),
+                     render.animation);
+            }
+            if (track.frames < 2 || track.frameNs == 0)
+                return;
+            elapsed = (now - track.start) * tickNs / track.frameNs;
+            render.frame = static_cast<uint16_t>(
+                (track.firstFrame + elapsed) % track.frames);
+        });
+        schedule(track, elapsed, tickNs);
+    }
+
+    /**
+     * @brief Queues the tick `track` leaves its frame `elapsed` (counted from
+     * its start) at, if its animation has several frames.
+     */
+    void schedule(Track& track, uint64_t elapsed, uint64_t tickNs)
+    {
+        track.due = 0;
+        if (track.frames < 2 || track.frameNs == 0)
+            return;
+
+        // First tick whose elapsed time reaches frame `elapsed + 1`
+        const uint64_t untilNext = (elapsed + 1) * track.frameNs;
+        track.due = track.start + (untilNext + tickNs - 1) / tickNs;
+        wheel[track.due & WHEEL_MASK].push_back({track.due, track.entity});
+    }
+
+    std::vector<EntityManager::Entity>
+        started;  ///< Entities given a Renderable since the last update.
+    std::vector<Track> tracks;  ///< By entity index.
+    std::vector<std::vector<Due>>
+        wheel = std::vector<std::vector<Due>>(WHEEL_SIZE);  ///< By tick.
+    std::vector<Due> bucket;  ///< Bucket being processed, reused.
+    uint64_t lastTick = 0;    ///< Tick of the last update.
+    Registry::ComponentSignal::Connection
+        constructed = 0;  ///< Listener of onConstruct<Renderable>().
 };
 }  // namespace GameEngine
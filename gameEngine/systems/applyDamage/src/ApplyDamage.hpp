@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+
+#include "../../../components/health/src/Health.hpp"
+#include "../../../ecs/Registry.hpp"
+#include "../../../ecs/System.hpp"
+#include "../../collision/src/Collision.hpp"
+
+namespace GameEngine {
+/**
+ * @class ApplyDamage
+ * @brief System applying the Damage of colliding entities to each other's
+ * Health.
+ *
+ * Reads the Contacts sent by Collision since its last update and, for each
+ * contact, removes the damage of each entity from the Health of the other.
+ * The damage is the one each entity had when the contact was found.
+ *
+ * @details
+ * **Behavior:**
+ * - Contacts are handled in the order Collision sent them
+ * - Health is clamped at zero and written through `Registry::patch()`, so
+ *   Death and ApplyScore hear about the hits
+ * - An entity at zero health is not hit again, but still deals its damage
+ * - Zero damage leaves the Health untouched, without a patch
+ * - Entities that lost their Health since the contact are skipped
+ *
+ * @performance
+ * - O(c) per update for c contacts, whatever the number of entities
+ *
+ * @see Collision
+ * @see Contacts
+ * @see Death
+ */
+class ApplyDamage : public System<ApplyDamage>
+{
+   public:
+    /**
+     * @brief Constructs the ApplyDamage system and declares its component
+     * requirements.
+     */
+    ApplyDamage()
+    {
+        requireComponents<GameEngine::Health>();
+        writeComponents<GameEngine::Health>();
+        readResources<Contacts>();
+    }
+
+    /**
+     * @brief Starts reading the Contacts sent from now on, emplacing the
+     * resource if the registry has none yet.
+     */
+    void onAttach(Registry& registry) override
+    {
+        cursor = registry.resources().getOrEmplace<Contacts>().end();
+    }
+
+    /**
+     * @brief Applies the contacts sent since the last update.
+     *
+     * @param registry Reference to the ECS Registry holding the Contacts.
+     * @param dt Delta time (unused).
+     */
+    void onUpdate(Registry& registry, float dt)
+    {
+        updateCount++;
+        const Contacts* contacts = registry.resources().find<Contacts>();
+        if (!contacts)
+            return;
+
+        contacts->read(cursor, [&registry](const Contact& contact) {
+            hit(registry, contact.first, contact.secondDamage);
+            hit(registry, contact.second, contact.firstDamage);
+        });
+    }
+
+    /// @brief Counter tracking the number of times onUpdate() was called.
+    int updateCount = 0;
+
+   private:
+    /// @brief Removes `dmg` from the Health of `target`.
+    static void hit(Registry& registry, EntityManager::Entity target, int dmg)
+    {
+        const Registry& reader = registry;
+        if (dmg == 0 || !reader.has<Health>(target) ||
+            reader.get<Health>(target).currentHp <= 0)
+            return;
+
+        registry.patch<Health>(target, [dmg](Health& health) {
+            health.currentHp = std::max(health.currentHp - dmg, 0);
+        });
+    }
+
+    Contacts::Cursor cursor = 0;  ///< Next contact to apply.
+};
+}  // namespace GameEngine
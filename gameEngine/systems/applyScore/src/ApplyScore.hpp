@@ -1,6 +1,6 @@
 #pragma once
 
-#include <bitset>
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 
@@ -10,27 +10,39 @@
 
 namespace GameEngine {
 
+/**
+ * @struct Score
+ * @brief Score of a world, kept in its resources (see
+ * `Registry::resources`) and raised by ApplyScore.
+ */
+struct Score
+{
+    int points = 0;  ///< Points earned so far.
+};
+
 /**
  * @class ApplyScore
  * @brief System that applies score values when entities lose all their health.
  *
- * The ApplyScore system monitors entities with both **ScoreValue** and
- * **Health** components. Whenever an entity's health reaches zero,
- * its associated score value is added to the global game score.
+ * The ApplyScore system listens to the Health signals of the registry.
+ * Whenever the health of an entity with a **ScoreValue** reaches zero, its
+ * associated score value is added to the Score resource of the registry.
  *
  * This system automates score accumulation based on gameplay events
  * such as enemy destruction, item collection, or objective completion.
  *
  * @details
  * **Behavior:**
- * - Iterates over all entities with ScoreValue and Health components.
- * - If `health.currentHp == 0`, adds `score.points` to `registry.score`.
+ * - Queues the entities whose Health is emplaced or patched at zero.
+ * - At update, adds `score.points` to the Score resource once per queued
+ *   entity still holding ScoreValue and zero health.
  * - Does not remove entities or reset their score after processing
  *   (handled by other systems if needed).
  *
  * @note
- * The system is purely reactive and stateless, aside from a simple
- * call counter used for testing or debugging.
+ * Health must be written through `Registry::patch()` to be noticed. The
+ * work done per tick is proportional to the number of deaths, not to the
+ * number of entities.
  *
  * @requires
  * - **ScoreValue**: Defines how many points an entity is worth.
@@ -39,7 +51,7 @@ namespace GameEngine {
  *
  * @see ScoreValue
  * @see Health
- * @see Registry
+ * @see Registry::onUpdate
  */
 class ApplyScore : public System<ApplyScore>
 {
@@ -57,14 +69,43 @@ class ApplyScore : public System<ApplyScore>
     ApplyScore()
     {
         requireComponents<GameEngine::ScoreValue, GameEngine::Health>();
+        writeResources<Score>();
+    }
+
+    /**
+     * @brief Starts queuing the scored entities whose Health is emplaced or
+     * patched at zero, and emplaces the Score resource if the registry has
+     * none yet.
+     */
+    void onAttach(Registry& registry) override
+    {
+        registry.resources().getOrEmplace<Score>();
+
+        auto queue = [this](Registry& registry, EntityManager::Entity e) {
+            const Registry& reader = registry;
+            if (reader.has<ScoreValue>(e) &&
+                reader.get<Health>(e).currentHp == 0) {
+                killed.push_back(e);
+            }
+        };
+        constructed = registry.onConstruct<Health>().connect(queue);
+        updated = registry.onUpdate<Health>().connect(queue);
+    }
+
+    /// @brief Disconnects the listeners of onAttach().
+    void onDetach(Registry& registry) override
+    {
+        registry.onConstruct<Health>().disconnect(constructed);
+        registry.onUpdate<Health>().disconnect(updated);
     }
 
     /**
-     * @brief Updates the global score based on destroyed entities.
+     * @brief Updates the global score based on the entities killed since the
+     * last update.
      *
-     * Iterates through all entities containing both **ScoreValue** and
-     * **Health**. If an entity's `Health::currentHp` equals zero, its
-     * `ScoreValue::points` are added to `registry.score`.
+     * Each entity queued by the Health signals is counted once. If it still
+     * has zero health, its `ScoreValue::points` are added to the Score
+     * resource.
      *
      * @param registry Reference to the ECS Registry.
      * @param dt Delta time (unused).
@@ -74,22 +115,32 @@ class ApplyScore : public System<ApplyScore>
      * ```cpp
      * // Example entity data:
      * // ScoreValue.points = 200
-     * // Health.currentHp = 0
-     * // Result: registry.score += 200
+     * // Health.currentHp patched to 0
+     * // Result: registry.resources().get<Score>().points += 200
      * ```
      *
      * @note This system does not modify or remove entities; it only affects
-     *       the global score counter.
+     *       the Score resource.
      */
     void onUpdate(Registry& registry, float dt)
     {
         updateCount++;
-        registry.each<ScoreValue, Health>(
-            [dt, &registry](auto e, ScoreValue& score, Health& health) {
-                if (health.currentHp == 0) {
-                    registry.score += score.points;
-                }
-            });
+
+        if (killed.empty())
+            return;
+
+        std::sort(killed.begin(), killed.end());
+        killed.erase(std::unique(killed.begin(), killed.end()), killed.end());
+
+        Score& score = registry.resources().get<Score>();
+        const Registry& reader = registry;
+        for (EntityManager::Entity e : killed) {
+            if (reader.has<ScoreValue>(e) && reader.has<Health>(e) &&
+                reader.get<Health>(e).currentHp == 0) {
+                score.points += reader.get<ScoreValue>(e).points;
+            }
+        }
+        killed.clear();
     }
 
     /**
@@ -101,6 +152,14 @@ class ApplyScore : public System<ApplyScore>
      * - Debugging ECS scheduling
      */
     int updateCount = 0;
+
+   private:
+    std::vector<EntityManager::Entity>
+        killed;  ///< Scored entities set to zero health since the last update.
+    Registry::ComponentSignal::Connection
+        constructed = 0;  ///< Listener of onConstruct<Health>().
+    Registry::ComponentSignal::Connection
+        updated = 0;  ///< Listener of onUpdate<Health>().
 };
 
 }  // namespace GameEngine
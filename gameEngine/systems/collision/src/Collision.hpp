@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <vector>
 
@@ -11,128 +12,284 @@
 #include "../../../components/renderable/src/Renderable.hpp"
 #include "../../../ecs/Registry.hpp"
 #include "../../../ecs/System.hpp"
+#include "CollisionKernel.hpp"
 
 namespace GameEngine {
+/**
+ * @struct Contact
+ * @brief Two colliding entities, as reported by Collision.
+ *
+ * Kept to 20 bytes, as a crowded scene sends hundreds of thousands of them
+ * per step; readers needing the overlap geometry recompute it from the
+ * Position and Collider of the two entities.
+ */
+struct Contact
+{
+    EntityManager::Entity first;   ///< Entity listed first by Collision.
+    EntityManager::Entity second;  ///< The other entity.
+    uint8_t firstLayers;   ///< Collider::entitySelector bits of `first`.
+    uint8_t secondLayers;  ///< Collider::entitySelector bits of `second`.
+    int firstDamage;       ///< Damage::dmg of `first`.
+    int secondDamage;      ///< Damage::dmg of `second`.
+};
+
+/// @brief Contacts of the last steps, kept in the resources of the registry.
+using Contacts = Events<Contact>;
+
+/**
+ * @class Collision
+ * @brief System reporting the pairs of colliding entities as Contacts.
+ *
+ * Two entities collide when each one's `entitySelector` shares a layer with
+ * the other's `entityDiff` and their hitboxes (Position + Collider) overlap.
+ * Entities at a negative position are ignored. Only entities with Damage,
+ * Health and Renderable take part.
+ *
+ * Each step, Collision calls Contacts::update() then sends one Contact per
+ * colliding pair. It writes no component: ApplyDamage, Pickup and any other
+ * reader act on the contacts in their own update, in O(contacts).
+ *
+ * @details
+ * **Broadphase:** a uniform grid of `cellSize` cells spanning the hitboxes
+ * of the step, rebuilt every step by counting sort into flat arrays kept
+ * between steps:
+ * 1. Each hitbox is copied once into a proxy (bounds, layers, damage)
+ * 2. Proxies are counted per overlapped cell, then scattered into one array
+ * 3. Each cell tests its pairs; a pair spanning several cells is only tested
+ * in the first cell both overlap, so it is tested once
+ *
+ * The grid follows the colliders wherever they are, on screen or not. When
+ * they are so spread out that the grid would need more than about two cells
+ * per collider, its cells are enlarged instead.
+ *
+ * **Narrowphase:** the sort also lays the hitboxes of each cell out as
+ * arrays, so overlapHitboxes() tests each hitbox against the rest of its
+ * cell several pairs per instruction, layer masks and first-cell check
+ * included. Only the colliding pairs are looked at one by one.
+ *
+ * @performance
+ * - O(n + p) per step for n colliders and p candidate pairs
+ * - No heap allocation once the arrays and the Contacts reached the size of
+ * the scene
+ * - Components are only read; each consequence of a contact is applied by
+ * the system reading it
+ *
+ * @see Collider
+ * @see Contacts
+ * @see ApplyDamage
+ */
 class Collision : public System<Collision>
 {
    private:
-    void collide(uint32_t e1, uint32_t e2, Registry& registry)
+    /// @brief Copy of what the pair tests need about one collider.
+    struct Proxy
     {
-        if (e1 == e2)
-            return;
+        Hitbox box;                      ///< Bounds and layer masks.
+        uint32_t firstColumn, firstRow;  ///< First cell overlapped.
+        int dmg;                         ///< Damage::dmg of the entity.
+        EntityManager::Entity entity;
+    };
+
+    /// @brief Contact between the colliding proxies `a` and `b`.
+    static Contact contactOf(const Proxy& a, const Proxy& b)
+    {
+        return {a.entity, b.entity, a.box.selector, b.box.selector, a.dmg,
+                b.dmg};
+    }
+
+    /// @brief Cell coordinate of `value`, `origin` being the grid's first.
+    uint32_t cellOf(float value, float origin) const
+    {
+        return static_cast<uint32_t>((value - origin) * inverseSide);
+    }
 
-        GameEngine::Position e1Pos = registry.get<GameEngine::Position>(e1);
-        GameEngine::Position e2Pos = registry.get<GameEngine::Position>(e2);
-
-        GameEngine::Collider e1Collider =
-            registry.get<GameEngine::Collider>(e1);
-        GameEngine::Collider e2Collider =
-            registry.get<GameEngine::Collider>(e2);
-
-        GameEngine::Damage e1Damage = registry.get<GameEngine::Damage>(e1);
-        GameEngine::Damage e2Damage = registry.get<GameEngine::Damage>(e2);
-
-        GameEngine::Health& e1Health = registry.get<GameEngine::Health>(e1);
-        GameEngine::Health& e2Health = registry.get<GameEngine::Health>(e2);
-
-        vec2 e1HitboxPos = e1Pos.pos + e1Collider.originTranslation;
-        vec2 e2HitboxPos = e2Pos.pos + e2Collider.originTranslation;
-
-        if ((e1Collider.entitySelector & e2Collider.entityDiff).any() &&
-            (e2Collider.entitySelector & e1Collider.entityDiff).any() &&
-            e1HitboxPos.x < e2HitboxPos.x + e2Collider.size.x &&
-            e1HitboxPos.x + e1Collider.size.x > e2HitboxPos.x &&
-            e1HitboxPos.y < e2HitboxPos.y + e2Collider.size.y &&
-            e1HitboxPos.y + e1Collider.size.y > e2HitboxPos.y) {
-            e1Health.currentHp =
-                e1Health.currentHp > 0
-                    ? std::max(e1Health.currentHp - e2Damage.dmg, 0)
-                    : e1Health.currentHp;
-            e2Health.currentHp =
-                e2Health.currentHp > 0
-                    ? std::max(e2Health.currentHp - e1Damage.dmg, 0)
-                    : e2Health.currentHp;
+    /**
+     * @brief Sizes the grid to cover [minX, maxX] x [minY, maxY] with
+     * `cellSize` cells, or larger ones past the cell budget.
+     */
+    void fit(float minX, float minY, float maxX, float maxY)
+    {
+        const double width = double(maxX) - minX;
+        const double height = double(maxY) - minY;
+        const double budget = std::max<double>(
+            MIN_CELL_BUDGET, 2.0 * double(proxies.size()));
+        double side = cellSize;
+        const double cells = (width / side + 1) * (height / side + 1);
+        if (cells > budget) {
+            side *= std::sqrt(cells / budget) + 1;
         }
+        inverseSide = static_cast<float>(1.0 / side);
+        originX = minX;
+        originY = minY;
+        columns = cellOf(maxX, minX) + 1;
+        rows = cellOf(maxY, minY) + 1;
     }
 
+    /// @brief Resizes the per-slot arrays of the sort to `slots` entries.
+    void resizeCells(size_t slots)
+    {
+        cellItems.resize(slots);
+        cellMinX.resize(slots);
+        cellMinY.resize(slots);
+        cellMaxX.resize(slots);
+        cellMaxY.resize(slots);
+        cellSelector.resize(slots);
+        cellDiff.resize(slots);
+        cellHome.resize(slots);
+        hits.resize(slots);
+    }
+
+    /// @brief `cellHome` bits: the cell is the proxy's first on that axis.
+    static constexpr uint8_t FIRST_COLUMN = 1;
+    static constexpr uint8_t FIRST_ROW = 2;
+
+    /// @brief Cells the grid may use whatever the collider count.
+    static constexpr double MIN_CELL_BUDGET = 4096;
+
    public:
-    Collision()
+    /**
+     * @brief Constructs the Collision system with `cellSize` grid cells.
+     *
+     * @param cellSize Side of the grid cells, in pixels; close to the usual
+     * hitbox size works best.
+     */
+    explicit Collision(float cellSize = 64.0f) : cellSize(cellSize)
     {
         requireComponents<
             GameEngine::Position, GameEngine::Renderable, GameEngine::Collider,
             GameEngine::Damage, GameEngine::Health>();
+        writeComponents<GameEngine::Damage>();  // Owned by the group
+        writeResources<Contacts>();
+    }
+
+    /// @brief Emplaces the Contacts resource if the registry has none yet.
+    void onAttach(Registry& registry) override
+    {
+        registry.resources().getOrEmplace<Contacts>();
     }
 
     void onUpdate(Registry& registry, float dt)
     {
         updateCount++;
+        Contacts& contacts = registry.resources().getOrEmplace<Contacts>();
+        contacts.update();
 
-        uint32_t screenSizeX = 1920;
-        uint32_t screenSizeY = 1080;
-        uint32_t hitboxSizeMean = 64;
-
-        int gridWidth = screenSizeX / hitboxSizeMean + 1;
-        int gridHeight = screenSizeY / hitboxSizeMean + 1;
-
-        std::vector<std::vector<std::vector<uint32_t>>> grid(
-            gridWidth, std::vector<std::vector<uint32_t>>(gridHeight));
-
-        registry.each<Position, Renderable, Collider, Damage, Health>(
-            [dt, &grid, hitboxSizeMean, gridWidth, gridHeight](
-                auto e, Position& pos, Renderable& render, Collider& collider,
-                Damage& damage, Health& health) {
+        // 1. Gather the proxies and their bounds
+        proxies.clear();
+        float minX = INFINITY, minY = INFINITY;
+        float maxX = -INFINITY, maxY = -INFINITY;
+        registry
+            .group<Damage>(observe<Position, Renderable, Collider, Health>)
+            .each([&](
+                      auto e, const Damage& damage, const Position& pos,
+                      const Renderable&, const Collider& collider,
+                      const Health&) {
                 if (pos.pos.x < 0 || pos.pos.y < 0)
                     return;
-                float rightPos = pos.pos.x + collider.size.x;
-                float topPos = pos.pos.y + collider.size.y;
-
-                int leftCell = pos.pos.x / hitboxSizeMean;
-                int bottomCell = pos.pos.y / hitboxSizeMean;
-                int rightCell = rightPos / hitboxSizeMean;
-                int topCell = topPos / hitboxSizeMean;
-
-                rightCell = std::min(rightCell, gridWidth - 1);
-                topCell = std::min(topCell, gridHeight - 1);
+                const vec2 min = pos.pos + collider.originTranslation;
+                const vec2 max = min + collider.size;
+                const Hitbox box{
+                    min.x, min.y, max.x, max.y,
+                    static_cast<uint8_t>(collider.entitySelector.to_ulong()),
+                    static_cast<uint8_t>(collider.entityDiff.to_ulong())};
+                proxies.push_back({box, 0, 0, damage.dmg, e});
+                minX = std::min(minX, min.x);
+                minY = std::min(minY, min.y);
+                maxX = std::max(maxX, max.x);
+                maxY = std::max(maxY, max.y);
+            });
+        if (proxies.size() < 2)
+            return;
+        fit(minX, minY, maxX, maxY);
 
-                for (int i = leftCell; i <= rightCell; i++) {
-                    for (int j = bottomCell; j <= topCell; j++) {
-                        grid[i][j].push_back(e);
-                    }
+        // 2. Counting sort of the proxy indices by overlapped cell
+        cellStart.assign(size_t(columns) * rows + 1, 0);
+        for (Proxy& proxy : proxies) {
+            proxy.firstColumn = cellOf(proxy.box.minX, originX);
+            proxy.firstRow = cellOf(proxy.box.minY, originY);
+            const uint32_t lastColumn = cellOf(proxy.box.maxX, originX);
+            const uint32_t lastRow = cellOf(proxy.box.maxY, originY);
+            for (uint32_t i = proxy.firstColumn; i <= lastColumn; i++) {
+                for (uint32_t j = proxy.firstRow; j <= lastRow; j++) {
+                    cellStart[size_t(i) * rows + j + 1]++;
                 }
-            });
-        for (int i = 0; i < grid.size(); i++) {
-            for (int j = 0; j < grid[i].size(); j++) {
-                while (grid[i][j].size() > 1) {
-                    for (int k = 1; k < grid[i][j].size(); k++) {
-                        collide(grid[i][j][0], grid[i][j][k], registry);
-                    }
-                    if (i + 1 < grid.size()) {
-                        for (int k = 0; k < grid[i + 1][j].size(); k++) {
-                            collide(grid[i][j][0], grid[i + 1][j][k], registry);
-                        }
-                    }
-                    if (j + 1 < grid[i].size()) {
-                        for (int k = 0; k < grid[i][j + 1].size(); k++) {
-                            collide(grid[i][j][0], grid[i][j + 1][k], registry);
-                        }
-                    }
-                    if (i + 1 < grid.size() && j + 1 < grid[i].size()) {
-                        for (int k = 0; k < grid[i + 1][j + 1].size(); k++) {
-                            collide(
-                                grid[i][j][0], grid[i + 1][j + 1][k], registry);
-                        }
-                    }
-                    if (i - 1 >= 0 && j + 1 < grid[i - 1].size()) {
-                        for (int k = 0; k < grid[i - 1][j + 1].size(); k++) {
-                            collide(
-                                grid[i][j][0], grid[i - 1][j + 1][k], registry);
-                        }
+            }
+        }
+        for (size_t c = 1; c < cellStart.size(); c++) {
+            cellStart[c] += cellStart[c - 1];
+        }
+        resizeCells(cellStart.back());
+        cellFill.assign(cellStart.begin(), cellStart.end() - 1);
+        for (uint32_t p = 0; p < proxies.size(); p++) {
+            const Proxy& proxy = proxies[p];
+            const uint32_t lastColumn = cellOf(proxy.box.maxX, originX);
+            const uint32_t lastRow = cellOf(proxy.box.maxY, originY);
+            for (uint32_t i = proxy.firstColumn; i <= lastColumn; i++) {
+                for (uint32_t j = proxy.firstRow; j <= lastRow; j++) {
+                    const uint32_t slot = cellFill[size_t(i) * rows + j]++;
+                    cellItems[slot] = p;
+                    cellMinX[slot] = proxy.box.minX;
+                    cellMinY[slot] = proxy.box.minY;
+                    cellMaxX[slot] = proxy.box.maxX;
+                    cellMaxY[slot] = proxy.box.maxY;
+                    cellSelector[slot] = proxy.box.selector;
+                    cellDiff[slot] = proxy.box.diff;
+                    cellHome[slot] =
+                        (proxy.firstColumn == i ? FIRST_COLUMN : 0) |
+                        (proxy.firstRow == j ? FIRST_ROW : 0);
+                }
+            }
+        }
+
+        // 3. Colliding pairs of each cell, kept in the first cell both
+        // overlap: the one where either proxy starts each axis
+        for (uint32_t i = 0; i < columns; i++) {
+            for (uint32_t j = 0; j < rows; j++) {
+                const uint32_t begin = cellStart[size_t(i) * rows + j];
+                const uint32_t end = cellStart[size_t(i) * rows + j + 1];
+                const HitboxArrays cell{
+                    cellMinX.data() + begin, cellMinY.data() + begin,
+                    cellMaxX.data() + begin, cellMaxY.data() + begin,
+                    cellSelector.data() + begin, cellDiff.data() + begin,
+                    cellHome.data() + begin, end - begin};
+                for (uint32_t k = 0; k + 1 < cell.count; k++) {
+                    const Proxy& a = proxies[cellItems[begin + k]];
+                    const uint8_t need =
+                        (FIRST_COLUMN | FIRST_ROW) & ~cellHome[begin + k];
+                    const size_t found = overlapHitboxes(
+                        a.box, cell, k + 1, hits.data(), need);
+                    for (size_t h = 0; h < found; h++) {
+                        contacts.send(contactOf(
+                            a, proxies[cellItems[begin + hits[h]]]));
                     }
-                    grid[i][j].erase(grid[i][j].begin());
                 }
             }
         }
     }
+
     int updateCount = 0;
+
+   private:
+    float cellSize;  ///< Requested side of a grid cell, in pixels.
+
+    float inverseSide = 0;  ///< 1 / side of the cells of the step.
+    float originX = 0;      ///< Left edge of the grid of the step.
+    float originY = 0;      ///< Top edge of the grid of the step.
+    uint32_t columns = 0;   ///< Cells along x.
+    uint32_t rows = 0;      ///< Cells along y.
+
+    std::vector<Proxy> proxies;  ///< Colliders of the current step.
+    std::vector<uint32_t>
+        cellStart;  ///< Offset of each cell in `cellItems`, column-major.
+    std::vector<uint32_t> cellFill;   ///< Scatter cursors of the sort.
+    std::vector<uint32_t> cellItems;  ///< Proxy indices, grouped by cell.
+    std::vector<float> cellMinX;      ///< Hitbox of each `cellItems` slot.
+    std::vector<float> cellMinY;
+    std::vector<float> cellMaxX;
+    std::vector<float> cellMaxY;
+    std::vector<uint8_t> cellSelector;
+    std::vector<uint8_t> cellDiff;
+    std::vector<uint8_t> cellHome;  ///< FIRST_COLUMN and FIRST_ROW bits.
+    std::vector<uint32_t> hits;  ///< Slots found by overlapHitboxes().
 };
 }  // namespace GameEngine
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+#endif
+
+namespace GameEngine {
+/**
+ * @struct Hitbox
+ * @brief Bounds and layers of one collider, as tested by the narrowphase.
+ */
+struct Hitbox
+{
+    float minX, minY, maxX, maxY;  ///< Bounds, `min` inclusive.
+    uint8_t selector;  ///< Layers the collider belongs to.
+    uint8_t diff;      ///< Layers the collider collides with.
+};
+
+/**
+ * @struct HitboxArrays
+ * @brief Structure-of-arrays view of the hitboxes tested by
+ * overlapHitboxes().
+ *
+ * Every array holds `count` entries; entry `i` of each array belongs to the
+ * same hitbox. Layer masks are the 8 bits of Collider::entitySelector and
+ * Collider::entityDiff.
+ *
+ * `flags` are free bits for the caller, e.g. the broadphase marking which
+ * pairs it already tested elsewhere; they may be null when unused.
+ */
+struct HitboxArrays
+{
+    const float* minX = nullptr;
+    const float* minY = nullptr;
+    const float* maxX = nullptr;
+    const float* maxY = nullptr;
+    const uint8_t* selector = nullptr;
+    const uint8_t* diff = nullptr;
+    const uint8_t* flags = nullptr;  ///< Caller bits, see `need`.
+
+    size_t count = 0;  ///< Number of hitboxes.
+};
+
+namespace detail {
+#if defined(__AVX2__)
+/// @brief 8-lane hitbox tests (AVX2).
+struct HitboxLanes
+{
+    using Type = __m256;
+    static constexpr size_t WIDTH = 8;
+
+    static Type load(const float* p)
+    {
+        return _mm256_loadu_ps(p);
+    }
+
+    static Type set(float v)
+    {
+        return _mm256_set1_ps(v);
+    }
+
+    static Type lt(Type a, Type b)
+    {
+        return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+    }
+
+    static Type both(Type a, Type b)
+    {
+        return _mm256_and_ps(a, b);
+    }
+
+    /// @brief Lanes whose byte of `p` shares a bit with `bits`.
+    static Type shares(const uint8_t* p, uint8_t bits)
+    {
+        const __m256i none = _mm256_cmpeq_epi32(
+            _mm256_and_si256(bytes(p), _mm256_set1_epi32(bits)),
+            _mm256_setzero_si256());
+        return _mm256_castsi256_ps(
+            _mm256_andnot_si256(none, _mm256_set1_epi32(-1)));
+    }
+
+    /// @brief Lanes whose byte of `p` has every bit of `bits`.
+    static Type covers(const uint8_t* p, uint8_t bits)
+    {
+        const __m256i wanted = _mm256_set1_epi32(bits);
+        return _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+            _mm256_and_si256(bytes(p), wanted), wanted));
+    }
+
+    /// @brief Widens 8 bytes of `p` to 32-bit lanes.
+    static __m256i bytes(const uint8_t* p)
+    {
+        return _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+    }
+
+    /// @brief One bit per lane, lane 0 lowest.
+    static unsigned bits(Type mask)
+    {
+        return static_cast<unsigned>(_mm256_movemask_ps(mask));
+    }
+};
+#elif defined(__SSE2__) || defined(_M_X64)
+/// @brief 4-lane hitbox tests (SSE2).
+struct HitboxLanes
+{
+    using Type = __m128;
+    static constexpr size_t WIDTH = 4;
+
+    static Type load(const float* p)
+    {
+        return _mm_loadu_ps(p);
+    }
+
+    static Type set(float v)
+    {
+        return _mm_set1_ps(v);
+    }
+
+    static Type lt(Type a, Type b)
+    {
+        return _mm_cmplt_ps(a, b);
+    }
+
+    static Type both(Type a, Type b)
+    {
+        return _mm_and_ps(a, b);
+    }
+
+    /// @brief Lanes whose byte of `p` shares a bit with `bits`.
+    static Type shares(const uint8_t* p, uint8_t bits)
+    {
+        const __m128i none = _mm_cmpeq_epi32(
+            _mm_and_si128(bytes(p), _mm_set1_epi32(bits)),
+            _mm_setzero_si128());
+        return _mm_castsi128_ps(_mm_andnot_si128(none, _mm_set1_epi32(-1)));
+    }
+
+    /// @brief Lanes whose byte of `p` has every bit of `bits`.
+    static Type covers(const uint8_t* p, uint8_t bits)
+    {
+        const __m128i wanted = _mm_set1_epi32(bits);
+        return _mm_castsi128_ps(
+            _mm_cmpeq_epi32(_mm_and_si128(bytes(p), wanted), wanted));
+    }
+
+    /// @brief Widens 4 bytes of `p` to 32-bit lanes.
+    static __m128i bytes(const uint8_t* p)
+    {
+        int32_t word;
+        std::memcpy(&word, p, sizeof(word));
+        const __m128i zero = _mm_setzero_si128();
+        return _mm_unpacklo_epi16(
+            _mm_unpacklo_epi8(_mm_cvtsi32_si128(word), zero), zero);
+    }
+
+    /// @brief One bit per lane, lane 0 lowest.
+    static unsigned bits(Type mask)
+    {
+        return static_cast<unsigned>(_mm_movemask_ps(mask));
+    }
+};
+#endif
+
+/// @brief Scalar test of `a` against the hitboxes [first, last).
+inline size_t overlapHitboxesTail(
+    const Hitbox& a, const HitboxArrays& boxes, size_t first, size_t last,
+    uint32_t* out, uint8_t need)
+{
+    size_t found = 0;
+    for (size_t i = first; i < last; ++i) {
+        const bool hit = (need == 0 || (boxes.flags[i] & need) == need) &&
+                         (a.selector & boxes.diff[i]) != 0 &&
+                         (boxes.selector[i] & a.diff) != 0 &&
+                         a.minX < boxes.maxX[i] && boxes.minX[i] < a.maxX &&
+                         a.minY < boxes.maxY[i] && boxes.minY[i] < a.maxY;
+        out[found] = static_cast<uint32_t>(i);
+        found += hit;
+    }
+    return found;
+}
+}  // namespace detail
+
+/**
+ * @brief Scalar reference of overlapHitboxes(), one pair at a time.
+ */
+inline size_t overlapHitboxesScalar(
+    const Hitbox& a, const HitboxArrays& boxes, size_t first, uint32_t* out,
+    uint8_t need = 0)
+{
+    return detail::overlapHitboxesTail(
+        a, boxes, first, boxes.count, out, need);
+}
+
+/**
+ * @brief Tests `a` against the hitboxes [first, boxes.count) and writes the
+ * index of each one colliding with it to `out`, in increasing order.
+ *
+ * Two hitboxes collide when each one's `selector` shares a bit with the
+ * other's `diff` and their bounds overlap; touching edges do not. With a
+ * non-zero `need`, hitboxes whose `flags` lack one of its bits are skipped.
+ *
+ * Tests 8 pairs per step with AVX2 or 4 with SSE2, depending on the compile
+ * target, and finishes the remainder with the scalar path. The results are
+ * the same as overlapHitboxesScalar(), NaN bounds included.
+ *
+ * @param out Room for `boxes.count - first` indices.
+ * @param need Bits required in `boxes.flags`, or 0 to ignore the flags.
+ * @return Number of indices written.
+ */
+inline size_t overlapHitboxes(
+    const Hitbox& a, const HitboxArrays& boxes, size_t first, uint32_t* out,
+    uint8_t need = 0)
+{
+    size_t i = first;
+    size_t found = 0;
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+    using L = detail::HitboxLanes;
+
+    const L::Type minX = L::set(a.minX);
+    const L::Type minY = L::set(a.minY);
+    const L::Type maxX = L::set(a.maxX);
+    const L::Type maxY = L::set(a.maxY);
+
+    for (; i + L::WIDTH <= boxes.count; i += L::WIDTH) {
+        const L::Type overlapX = L::both(
+            L::lt(minX, L::load(boxes.maxX + i)),
+            L::lt(L::load(boxes.minX + i), maxX));
+        const L::Type overlapY = L::both(
+            L::lt(minY, L::load(boxes.maxY + i)),
+            L::lt(L::load(boxes.minY + i), maxY));
+        L::Type layers = L::both(
+            L::shares(boxes.diff + i, a.selector),
+            L::shares(boxes.selector + i, a.diff));
+        if (need != 0) {
+            layers = L::both(layers, L::covers(boxes.flags + i, need));
+        }
+        const unsigned hits = L::bits(
+            L::both(L::both(overlapX, overlapY), layers));
+
+        // Hits are rare: compact without branching on each lane
+        if (hits != 0) {
+            for (size_t lane = 0; lane < L::WIDTH; ++lane) {
+                out[found] = static_cast<uint32_t>(i + lane);
+                found += (hits >> lane) & 1U;
+            }
+        }
+    }
+#endif
+
+    return found + detail::overlapHitboxesTail(
+                       a, boxes, i, boxes.count, out + found, need);
+}
+}  // namespace GameEngine
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <algorithm>
-#include <functional>
+#include <vector>
 
 #include "../../../components/health/src/Health.hpp"
 #include "../../../components/inputControlled/src/InputControlled.hpp"
@@ -13,16 +13,16 @@ namespace GameEngine {
  * @class Death
  * @brief System that removes entities with zero health from the simulation.
  *
- * The Death system iterates through all entities that possess a Health
- * component and automatically destroys any entity whose `currentHp` reaches
- * zero. This ensures that dead entities are cleaned up from the ECS registry
- * automatically each frame.
+ * The Death system listens to the Health signals of the registry and
+ * destroys every entity whose `currentHp` reaches zero. This ensures that
+ * dead entities are cleaned up from the ECS registry automatically each
+ * frame.
  *
  * @details
  * This system is part of the damage and death handling pipeline:
- * 1. Other systems reduce entity health (e.g., DamageSystem)
- * 2. Death system checks for zero health each update
- * 3. Dead entities are removed from the simulation
+ * 1. Other systems reduce entity health through `Registry::patch()`
+ * 2. The Health signals queue the entities left at zero health
+ * 3. Death destroys the queued entities at its next update
  *
  * This approach decouples the death logic from damage dealing, allowing
  * flexible death handling without tight coupling.
@@ -32,13 +32,13 @@ namespace GameEngine {
  * negative.
  *
  * @performance
- * - Time Complexity: O(n) where n is the number of entities with Health
- * components
- * - Space Complexity: O(1) - only iteration, no additional storage
+ * - Time Complexity: O(k) where k is the number of Health components set
+ * to zero since the last update
+ * - Space Complexity: O(k) for the queue of dying entities
  *
  * @see Health
- * @see Registry::each
- * @see Registry::destroy
+ * @see Registry::onUpdate
+ * @see Registry::commands
  */
 class Death : public System<Death>
 {
@@ -48,68 +48,92 @@ class Death : public System<Death>
      * requirements.
      *
      * During construction, the system declares that it requires the Health
-     * component. The ECS registry will only activate this system when at least
-     * one entity with a Health component exists.
+     * component and reads InputControlled to tell players apart.
      *
      * @post System is configured to process entities with Health components.
      * @post The system is ready for scheduling within the Registry.
      */
     Death()
     {
-        requireComponents<GameEngine::Health, InputControlled>();
+        requireComponents<GameEngine::Health>();
+        readComponents<InputControlled>();
+        changeEntities();
     }
 
     /**
-     * @brief Processes all entities with Health components and destroys those
-     * with zero HP.
+     * @brief Starts queuing the entities whose Health is emplaced or patched
+     * at zero.
+     */
+    void onAttach(Registry& registry) override
+    {
+        auto queue = [this](Registry& registry, EntityManager::Entity e) {
+            const Registry& reader = registry;
+            if (reader.get<Health>(e).currentHp == 0) {
+                dying.push_back(e);
+            }
+        };
+        constructed = registry.onConstruct<Health>().connect(queue);
+        updated = registry.onUpdate<Health>().connect(queue);
+    }
+
+    /// @brief Disconnects the listeners of onAttach().
+    void onDetach(Registry& registry) override
+    {
+        registry.onConstruct<Health>().disconnect(constructed);
+        registry.onUpdate<Health>().disconnect(updated);
+    }
+
+    /**
+     * @brief Destroys the entities whose health reached zero since the last
+     * update.
      *
      * Called every frame by the Registry. This method:
      * 1. Increments the update counter for profiling/debugging
-     * 2. Iterates through all entities with a Health component
-     * 3. Checks each entity's `currentHp` value
-     * 4. Destroys any entity with exactly zero health
+     * 2. Goes through the entities queued by the Health signals, once each
+     * 3. Skips those already destroyed or healed in the meantime
+     * 4. Publishes onPlayerDeath for players, then destroys the entity
      *
      * @param registry Reference to the main ECS Registry for entity management.
      * @param dt Delta time since last update in seconds. Unused but provided
      *           for consistency with the System interface.
      *
-     * @attention Destroying entities during iteration is safe because the ECS
-     * system uses optimized pool iteration that doesn't invalidate cursors.
-     *
      * @warning If an entity's health goes below zero (negative HP), it will NOT
      * be destroyed by this system. Ensure damage systems clamp health to 0.
      *
      * @example
      * ```cpp
      * Registry registry;
-     * Death deathSystem;
+     * registry.addSystem<Death>();
      *
-     * // If entity `e` has Health with currentHp = 0:
+     * registry.patch<Health>(e, [](Health& health) { health.currentHp = 0; });
      * registry.update(0.016f); // Entity `e` will be destroyed
      * ```
      *
-     * @see Registry::each
-     * @see Registry::destroy
+     * @see Registry::patch
+     * @see Registry::commands
      * @see Health::currentHp
      */
     void onUpdate(Registry& registry, float dt)
     {
         updateCount++;
 
-        registry.each<Health, InputControlled>(
-            [this, &registry](auto e, Health& health, InputControlled&) {
-                if (health.currentHp == 0) {
-                    if (onPlayerDeath)
-                        onPlayerDeath(e);
-                    registry.destroy(e);
-                }
-            });
+        if (dying.empty())
+            return;
 
-        registry.each<Health>([dt, &registry](auto e, Health& health) {
-            if (health.currentHp == 0) {
-                registry.destroy(e);
+        std::sort(dying.begin(), dying.end());
+        dying.erase(std::unique(dying.begin(), dying.end()), dying.end());
+
+        CommandBuffer& commands = registry.commands();
+        const Registry& reader = registry;
+        for (EntityManager::Entity e : dying) {
+            if (!reader.has<Health>(e) || reader.get<Health>(e).currentHp != 0)
+                continue;
+            if (reader.has<InputControlled>(e)) {
+                onPlayerDeath.publish(e);
             }
-        });
+            commands.destroy(e);
+        }
+        dying.clear();
     }
 
     /**
@@ -124,6 +148,17 @@ class Death : public System<Death>
      *          Manually reset if needed for test isolation.
      */
     int updateCount = 0;
-    std::function<void(EntityManager::Entity)> onPlayerDeath;
+
+    /// @brief Published with each player (InputControlled entity) that dies,
+    /// right before its destruction is recorded.
+    Signal<EntityManager::Entity> onPlayerDeath;
+
+   private:
+    std::vector<EntityManager::Entity>
+        dying;  ///< Entities set to zero health since the last update.
+    Registry::ComponentSignal::Connection
+        constructed = 0;  ///< Listener of onConstruct<Health>().
+    Registry::ComponentSignal::Connection
+        updated = 0;  ///< Listener of onUpdate<Health>().
 };
 }  // namespace GameEngine
@@ -54,6 +54,7 @@ class DomainHandler : public System<DomainHandler>
     {
         requireComponents<
             GameEngine::Position, GameEngine::Domain, GameEngine::Collider>();
+        changeEntities();
     }
 
     /**
@@ -81,21 +82,22 @@ class DomainHandler : public System<DomainHandler>
      * uses the smallest pool for optimization, which doesn't invalidate
      * iterators for subsequent entities.
      *
-     * @see Registry::each
-     * @see Registry::destroy
+     * @see Registry::parallelEach
+     * @see Registry::commands
      */
     void onUpdate(Registry& registry, float dt)
     {
         updateCount++;
 
-        registry.each<Position, Domain, Collider>(
-            [dt, &registry](
+        // Jobs run on several threads: each records into its own buffer
+        registry.parallelEach<Position, Domain, Collider>(
+            [&registry](
                 auto e, Position& pos, Domain& domain, Collider& collider) {
                 if (pos.pos.x < domain.ax ||
                     pos.pos.x + collider.size.x > domain.bx ||
                     pos.pos.y < domain.ay ||
                     pos.pos.y + collider.size.y > domain.by) {
-                    registry.destroy(e);
+                    registry.commands().destroy(e);
                 }
             });
     }
@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <functional>
+#include <utility>
+#include <vector>
 
 #include "../../../components/AIControlled/src/AIControlled.hpp"
 #include "../../../components/fireRate/src/FireRate.hpp"
@@ -61,6 +63,32 @@ class EnemyShoot : public System<EnemyShoot>
         requireComponents<
             GameEngine::FireRate, GameEngine::AIControlled,
             GameEngine::Velocity, GameEngine::Position>();
+        writeComponents<
+            GameEngine::FireRate, GameEngine::Renderable, GameEngine::Health,
+            GameEngine::Damage, GameEngine::Velocity, GameEngine::Acceleration,
+            GameEngine::Position, GameEngine::Collider, GameEngine::Domain>();
+        changeEntities();
+
+        projectile.with<GameEngine::Health>(1, 1)
+            .with<GameEngine::Damage>(1)
+            .with<GameEngine::Collider>(
+                vec2(0.0, 0.0), std::bitset<8>("00010000"),
+                std::bitset<8>("01000000"), vec2(44.56, 44.56))
+            .with<GameEngine::Domain>(5, 0, 1920.0, 1080.0);
+    }
+
+    /**
+     * @brief Interns the projectile sprite in the AssetRegistry of
+     * `registry` and adds it to the projectile prefab.
+     */
+    void onAttach(Registry& registry) override
+    {
+        auto& assets = registry.resources().getOrEmplace<AssetRegistry>();
+        projectile.with<GameEngine::Renderable>(
+            assets.sheet("assets/sprites/playerProjectiles.png"),
+            assets.animation(
+                {vec2{0.0F, 0.0F}, vec2{19.0F, 0.0F}, vec2{38.0F, 0.0F}},
+                vec2{22.28f, 22.28f}, 50, true));
     }
 
     /**
@@ -100,37 +128,23 @@ class EnemyShoot : public System<EnemyShoot>
     {
         updateCount++;
 
+        CommandBuffer& commands = registry.commands();
+
         registry.each<FireRate, AIControlled, Velocity, Position>(
-            [this, &registry, dt](
+            [this, &commands, dt](
                 auto e, FireRate& fireRate, AIControlled& ai, Velocity& vel,
                 Position& pos) {
-                std::vector<vec2> rectPos;
-                uint32_t shoot = -1;
                 fireRate.time += dt;
                 if (fireRate.time < fireRate.fireRate)
                     return;
-                shoot = registry.create();
-                rectPos.clear();
-                rectPos.push_back(vec2{0.0F, 0.0F});
-                rectPos.push_back(vec2{19.0F, 0.0F});
-                rectPos.push_back(vec2{38.0F, 0.0F});
-                registry.emplace<GameEngine::Renderable>(
-                    shoot, 1920.0, 1080.0,
-                    "assets/sprites/playerProjectiles.png", rectPos,
-                    vec2{22.28f, 22.28f}, 50, true);
-                registry.emplace<GameEngine::Health>(shoot, 1, 1);
-                registry.emplace<GameEngine::Damage>(shoot, 1);
-                registry.emplace<GameEngine::Velocity>(
-                    shoot, vel.speedMax + 200.0, -(vel.speedMax + 200.0));
-                registry.emplace<GameEngine::Acceleration>(
-                    shoot, -(vel.speedMax + 200.0));
-                registry.emplace<GameEngine::Position>(
-                    shoot, pos.pos.x, pos.pos.y);
-                registry.emplace<GameEngine::Collider>(
-                    shoot, vec2(0.0, 0.0), std::bitset<8>("00010000"),
-                    std::bitset<8>("01000000"), vec2(44.56, 44.56));
-                registry.emplace<GameEngine::Domain>(
-                    shoot, 5, 0, 1920.0, 1080.0);
+                commands.spawn(projectile, [&](EntityManager::Entity shoot) {
+                    commands.emplace<GameEngine::Velocity>(
+                        shoot, vel.speedMax + 200.0, -(vel.speedMax + 200.0));
+                    commands.emplace<GameEngine::Acceleration>(
+                        shoot, -(vel.speedMax + 200.0));
+                    commands.emplace<GameEngine::Position>(
+                        shoot, pos.pos.x, pos.pos.y);
+                });
                 fireRate.time = 0.0F;
             });
     }
@@ -148,5 +162,9 @@ class EnemyShoot : public System<EnemyShoot>
      */
     int updateCount = 0;
     std::function<void(EntityManager::Entity)> onPlayerDeath;
+
+   private:
+    /// @brief Components shared by every enemy projectile.
+    Prefab projectile;
 };
 }  // namespace GameEngine
@@ -2,6 +2,7 @@
 
 #include <bitset>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "../../../components/acceleration/src/Acceleration.hpp"
@@ -85,6 +86,37 @@ class InputHandler : public System<InputHandler>
         requireComponents<
             GameEngine::InputControlled, GameEngine::Acceleration,
             GameEngine::FireRate>();
+        readComponents<GameEngine::Position>();
+        writeComponents<
+            GameEngine::Acceleration, GameEngine::FireRate,
+            GameEngine::Renderable, GameEngine::Health, GameEngine::Damage,
+            GameEngine::Velocity, GameEngine::Position, GameEngine::Collider,
+            GameEngine::Domain>();
+        changeEntities();
+
+        projectile.with<GameEngine::Health>(1, 1)
+            .with<GameEngine::Damage>(1)
+            .with<GameEngine::Velocity>(1000.0, 1000.0)
+            .with<GameEngine::Acceleration>(1000.0)
+            .with<GameEngine::Position>()
+            .with<GameEngine::Collider>(
+                vec2(0.0, 0.0), std::bitset<8>("01000000"),
+                std::bitset<8>("00100000"), vec2(44.56, 44.56))
+            .with<GameEngine::Domain>(0, 0, 1905.0, 1080.0);
+    }
+
+    /**
+     * @brief Interns the projectile sprite in the AssetRegistry of
+     * `registry` and adds it to the projectile prefab.
+     */
+    void onAttach(Registry& registry) override
+    {
+        auto& assets = registry.resources().getOrEmplace<AssetRegistry>();
+        projectile.with<GameEngine::Renderable>(
+            assets.sheet("assets/sprites/playerProjectiles.png"),
+            assets.animation(
+                {vec2{0.0F, 0.0F}, vec2{19.0F, 0.0F}, vec2{38.0F, 0.0F}},
+                vec2{22.28f, 22.28f}, 50, true));
     }
 
     /**
@@ -106,7 +138,7 @@ class InputHandler : public System<InputHandler>
      * - Shoot input (4) creates a new projectile entity with full setup
      *
      * **Projectile Properties:**
-     * - Position: Copied from player entity
+     * - Position: Copied from player entity (origin if it has none)
      * - Velocity: (10.0, 10.0) pixels per second
      * - Acceleration: 10.0 (2D scalar)
      * - Health: 1 HP (destroyed on first collision)
@@ -144,17 +176,17 @@ class InputHandler : public System<InputHandler>
     void onUpdate(Registry& registry, float dt)
     {
         updateCount++;
+        CommandBuffer& commands = registry.commands();
+
         registry.each<InputControlled, Acceleration, FireRate>(
-            [dt, &registry](
-                auto e, InputControlled& inputs, Acceleration& acceleration,
-                FireRate& fireRate) {
+            optional<GameEngine::Position>,
+            [this, dt, &commands](
+                auto, InputControlled& inputs, Acceleration& acceleration,
+                FireRate& fireRate, GameEngine::Position* position) {
                 fireRate.time += dt;
                 float accelerationValue = 2000.0;
-                GameEngine::Position playerPos;
-                uint32_t shoot = -1;
                 acceleration.x = 0;
                 acceleration.y = 0;
-                std::vector<vec2> rectPos;
 
                 for (auto& it : inputs.inputs) {
                     switch (it) {
@@ -179,30 +211,13 @@ class InputHandler : public System<InputHandler>
                             /// component setup
                             if (fireRate.time < fireRate.fireRate)
                                 break;
-                            shoot = registry.create();
-                            rectPos.clear();
-                            rectPos.push_back(vec2{0.0F, 0.0F});
-                            rectPos.push_back(vec2{19.0F, 0.0F});
-                            rectPos.push_back(vec2{38.0F, 0.0F});
-                            registry.emplace<GameEngine::Renderable>(
-                                shoot, 1920.0, 1080.0,
-                                "assets/sprites/playerProjectiles.png", rectPos,
-                                vec2{22.28f, 22.28f}, 50, true);
-                            registry.emplace<GameEngine::Health>(shoot, 1, 1);
-                            registry.emplace<GameEngine::Damage>(shoot, 1);
-                            registry.emplace<GameEngine::Velocity>(
-                                shoot, 1000.0, 1000.0);
-                            registry.emplace<GameEngine::Acceleration>(
-                                shoot, 1000.0);
-                            playerPos = registry.get<GameEngine::Position>(e);
-                            registry.emplace<GameEngine::Position>(
-                                shoot, playerPos.pos.x, playerPos.pos.y);
-                            registry.emplace<GameEngine::Collider>(
-                                shoot, vec2(0.0, 0.0),
-                                std::bitset<8>("01000000"),
-                                std::bitset<8>("00100000"), vec2(44.56, 44.56));
-                            registry.emplace<GameEngine::Domain>(
-                                shoot, 0, 0, 1905.0, 1080.0);
+                            commands.spawn(
+                                projectile, [&](EntityManager::Entity shoot) {
+                                    if (position) {
+                                        commands.emplace<GameEngine::Position>(
+                                            shoot, *position);
+                                    }
+                                });
                             fireRate.time = 0.0F;
                             break;
                         default:
@@ -223,5 +238,10 @@ class InputHandler : public System<InputHandler>
      * @remarks Persists across frames; reset manually if needed for testing.
      */
     int updateCount = 0;
+
+   private:
+    /// @brief Components of a player projectile, spawned at the origin
+    /// unless the player has a Position.
+    Prefab projectile;
 };
 }  // namespace GameEngine
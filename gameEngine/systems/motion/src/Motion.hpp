@@ -38,7 +38,7 @@ namespace GameEngine {
  *
  * 3. **Position Update Phase**: Translates entity position by velocity
  *    - Position clamped to screen bounds: [0, screenSize]
- *    - Uses Renderable component for screen dimensions
+ *    - Uses the Viewport resource for screen dimensions
  *
  * **Deceleration Formula:**
  * ```
@@ -51,7 +51,8 @@ namespace GameEngine {
  * - Position: Current location to update
  * - Velocity: Current movement speed with speedMax limit
  * - Acceleration: Forces to apply
- * - Renderable: Screen size for boundary constraints
+ * - Renderable: Only rendered entities move
+ * - Viewport (resource): Screen size for boundary constraints
  *
  * @performance
  * - Time Complexity: O(n) where n is number of moving entities
@@ -73,7 +74,7 @@ class Motion : public System<Motion>
      * - Position: Entity location
      * - Velocity: Current movement speed
      * - Acceleration: Force to apply
-     * - Renderable: Screen boundary information
+     * - Viewport (resource): Screen boundary information
      *
      * The system only processes entities with all four components.
      *
@@ -85,6 +86,10 @@ class Motion : public System<Motion>
             GameEngine::Position, GameEngine::Velocity,
             GameEngine::Acceleration, GameEngine::Renderable,
             GameEngine::Collider>();
+        writeComponents<
+            GameEngine::Position, GameEngine::Velocity,
+            GameEngine::Acceleration>();
+        readResources<GameEngine::Viewport>();
     }
 
     /**
@@ -107,7 +112,7 @@ class Motion : public System<Motion>
      *
      * **Phase 3: Position Update (Movement)**
      * - Translates position by velocity amount
-     * - Clamps position to screen bounds using Renderable dimensions
+     * - Clamps position to screen bounds using the Viewport resource
      * - Ensures entities never leave the visible play area
      *
      * @param registry Reference to the ECS Registry (unused but required by
@@ -127,9 +132,9 @@ class Motion : public System<Motion>
      * - Prevents physics simulation instability
      *
      * **Boundary Constraints:**
-     * - Screen position: [0, screenSizeX] and [0, screenSizeY]
+     * - Screen position: [0, width] and [0, height] of the Viewport
      * - Entities cannot move beyond screen edges
-     * - Uses Renderable component for screen resolution
+     * - Falls back to a default Viewport when the world has none
      *
      * @attention
      * - Deceleration applies EVERY frame, not just when no input
@@ -155,7 +160,7 @@ class Motion : public System<Motion>
      * // Next frame: vel becomes (1.25, 0), pos becomes (506.25, 500)
      * ```
      *
-     * @see Registry::each
+     * @see Registry::group
      * @see Position
      * @see Velocity
      * @see Acceleration
@@ -163,11 +168,15 @@ class Motion : public System<Motion>
     void onUpdate(Registry& registry, float dt)
     {
         updateCount++;
+        const Viewport* found = registry.resources().find<Viewport>();
+        const Viewport viewport = found ? *found : Viewport{};
 
-        registry.each<Position, Velocity, Acceleration, Renderable, Collider>(
-            [dt](
-                auto e, Position& pos, Velocity& vel, Acceleration& acc,
-                Renderable& render, Collider& collider) {
+        registry
+            .group<Velocity, Acceleration>(
+                observe<Position, Renderable, Collider>)
+            .parallelEach([dt, viewport](
+                      auto e, Velocity& vel, Acceleration& acc, Position& pos,
+                      Renderable&, Collider& collider) {
                 // Phase 1: Acceleration (apply forces and clamp to speed limit)
                 vel.x = std::clamp(
                     vel.x + (acc.x * dt), -vel.speedMax, vel.speedMax);
@@ -178,10 +187,10 @@ class Motion : public System<Motion>
                 // bounds)
                 pos.pos.x = std::clamp(
                     pos.pos.x + (vel.x * dt), float(0),
-                    render.screenSizeX - collider.size.x);
+                    viewport.width - collider.size.x);
                 pos.pos.y = std::clamp(
                     pos.pos.y + (vel.y * dt), float(0),
-                    render.screenSizeY - collider.size.y);
+                    viewport.height - collider.size.y);
 
                 // Phase 3: Deceleration (600 pixels reduction)
                 if (acc.decceleration) {
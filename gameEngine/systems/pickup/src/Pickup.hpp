@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "../../../components/damage/src/Damage.hpp"
+#include "../../../components/fireRate/src/FireRate.hpp"
+#include "../../../components/health/src/Health.hpp"
+#include "../../../components/onPickup/src/OnPickup.hpp"
+#include "../../../ecs/Registry.hpp"
+#include "../../../ecs/System.hpp"
+#include "../../collision/src/Collision.hpp"
+
+namespace GameEngine {
+/**
+ * @class Pickup
+ * @brief System granting the OnPickup bonuses of an entity to the first
+ * entity colliding with it, then destroying it.
+ *
+ * Reads the Contacts sent by Collision since its last update. A pickup is an
+ * entity with OnPickup and the Collision components; its Damage is usually
+ * zero, and its Collider layers choose who may collect it.
+ *
+ * @details
+ * **Bonuses granted to the collector:**
+ * - `hpMaxBonus` raises Health::maxHp, then `hpBonus` heals up to it
+ * - `dmgBonus` raises Damage::dmg
+ * - `cooldownBonus` lowers FireRate::fireRate, down to zero
+ *
+ * Bonuses whose component the collector lacks are lost. `scoreMultiplierBonus`
+ * and `duration` have no effect yet: there are no timed effects nor score
+ * multiplier to apply them to.
+ *
+ * **Rules:**
+ * - A pickup is collected once, by the first contact found, and destroyed
+ *   through the command buffer
+ * - Entities at zero health and other pickups do not collect
+ *
+ * @performance
+ * - O(c) per update for c contacts, whatever the number of entities
+ *
+ * @see OnPickup
+ * @see Collision
+ * @see Contacts
+ */
+class Pickup : public System<Pickup>
+{
+   public:
+    /**
+     * @brief Constructs the Pickup system and declares its component
+     * requirements.
+     */
+    Pickup()
+    {
+        requireComponents<GameEngine::OnPickup>();
+        writeComponents<
+            GameEngine::Health, GameEngine::Damage, GameEngine::FireRate>();
+        readResources<Contacts>();
+        changeEntities();
+    }
+
+    /**
+     * @brief Starts reading the Contacts sent from now on, emplacing the
+     * resource if the registry has none yet.
+     */
+    void onAttach(Registry& registry) override
+    {
+        cursor = registry.resources().getOrEmplace<Contacts>().end();
+    }
+
+    /**
+     * @brief Hands out the pickups touched since the last update.
+     *
+     * @param registry Reference to the ECS Registry holding the Contacts.
+     * @param dt Delta time (unused).
+     */
+    void onUpdate(Registry& registry, float dt)
+    {
+        updateCount++;
+        const Contacts* contacts = registry.resources().find<Contacts>();
+        if (!contacts)
+            return;
+
+        contacts->read(cursor, [&](const Contact& contact) {
+            if (!collect(registry, contact.first, contact.second)) {
+                collect(registry, contact.second, contact.first);
+            }
+        });
+        collected.clear();
+    }
+
+    /// @brief Counter tracking the number of times onUpdate() was called.
+    int updateCount = 0;
+
+   private:
+    /**
+     * @brief Grants the bonuses of `pickup` to `collector` and destroys
+     * `pickup`, if it is a pickup not collected yet.
+     * @return Whether `pickup` was collected.
+     */
+    bool collect(
+        Registry& registry, EntityManager::Entity pickup,
+        EntityManager::Entity collector)
+    {
+        const Registry& reader = registry;
+        if (!reader.has<OnPickup>(pickup) || reader.has<OnPickup>(collector) ||
+            std::find(collected.begin(), collected.end(), pickup) !=
+                collected.end())
+            return false;
+        if (reader.has<Health>(collector) &&
+            reader.get<Health>(collector).currentHp <= 0)
+            return false;
+
+        const OnPickup bonus = reader.get<OnPickup>(pickup);
+        if (reader.has<Health>(collector) &&
+            (bonus.hpBonus != 0 || bonus.hpMaxBonus != 0)) {
+            registry.patch<Health>(collector, [&bonus](Health& health) {
+                health.maxHp += bonus.hpMaxBonus;
+                health.currentHp = std::min(
+                    health.currentHp + bonus.hpBonus, health.maxHp);
+            });
+        }
+        if (reader.has<Damage>(collector) && bonus.dmgBonus != 0) {
+            registry.patch<Damage>(collector, [&bonus](Damage& damage) {
+                damage.dmg += bonus.dmgBonus;
+            });
+        }
+        if (reader.has<FireRate>(collector) && bonus.cooldownBonus != 0) {
+            registry.patch<FireRate>(collector, [&bonus](FireRate& rate) {
+                rate.fireRate =
+                    std::max(rate.fireRate - bonus.cooldownBonus, 0.0F);
+            });
+        }
+
+        collected.push_back(pickup);
+        registry.commands().destroy(pickup);
+        return true;
+    }
+
+    Contacts::Cursor cursor = 0;  ///< Next contact to read.
+    std::vector<EntityManager::Entity>
+        collected;  ///< Pickups collected during the current update.
+};
+}  // namespace GameEngine
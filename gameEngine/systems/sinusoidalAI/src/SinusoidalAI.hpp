@@ -43,6 +43,7 @@ struct SinusoidalPattern : public Component<SinusoidalPattern>
     static constexpr const char* Name = "SinusoidalPattern";
     static constexpr const char* Version = "1.0.0";
 };
+static_assert(isTrivialComponent<SinusoidalPattern>);
 
 /**
  * @class SinusoidalAI
@@ -70,7 +71,8 @@ struct SinusoidalPattern : public Component<SinusoidalPattern>
  * - SinusoidalPattern: Configuration for wave parameters
  * - Position: Current location for sine calculation
  * - Velocity: To apply vertical sinusoidal movement
- * - Renderable: Screen bounds for clamping
+ * - Renderable: Only rendered entities follow the pattern
+ * - Viewport (resource): Screen bounds for clamping
  * - Collider: Entity size for boundary calculations
  */
 class SinusoidalAI : public System<SinusoidalAI>
@@ -88,6 +90,8 @@ class SinusoidalAI : public System<SinusoidalAI>
             GameEngine::AIControlled, GameEngine::SinusoidalPattern,
             GameEngine::Position, GameEngine::Velocity, GameEngine::Renderable,
             GameEngine::Collider>();
+        writeComponents<GameEngine::SinusoidalPattern, GameEngine::Velocity>();
+        readResources<GameEngine::Viewport>();
     }
 
     /**
@@ -133,15 +137,19 @@ class SinusoidalAI : public System<SinusoidalAI>
      */
     void onUpdate(Registry& registry, float dt)
     {
-        registry.each<
-            AIControlled, SinusoidalPattern, Position, Velocity, Renderable,
-            Collider>([](auto e, AIControlled& ai, SinusoidalPattern& pattern,
-                         Position& pos, Velocity& vel, Renderable& render,
-                         Collider& collider) {
+        const Viewport* found = registry.resources().find<Viewport>();
+        const Viewport viewport = found ? *found : Viewport{};
+
+        registry
+            .group<SinusoidalPattern>(observe<
+                AIControlled, Position, Velocity, Renderable, Collider>)
+            .parallelEach([viewport](auto e, SinusoidalPattern& pattern,
+                     AIControlled& ai, Position& pos, Velocity& vel,
+                     Renderable&, Collider& collider) {
             // Calculate safe amplitude to prevent screen overflow
             float topMargin = pos.pos.y;
             float bottomMargin =
-                render.screenSizeY - pos.pos.y - collider.size.y;
+                viewport.height - pos.pos.y - collider.size.y;
             float safeAmplitude = std::min(
                 {pattern.amplitude,
                  topMargin - 10.0f,  // Keep 10px safety margin
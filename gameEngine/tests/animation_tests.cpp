@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "../ecs/Registry.hpp"
+#include "../components/renderable/src/Renderable.hpp"
+#include "../systems/animation/src/Animation.hpp"
+#include <vector>
+
+using namespace GameEngine;
+
+namespace {
+/// Registry stepping 10ms ticks, with a 3-frame 50ms animation
+struct AnimatedWorld {
+    Registry registry;
+    AssetRegistry& assets = registry.resources().getOrEmplace<AssetRegistry>();
+    AnimationID blink = assets.animation(
+        {vec2(0, 0), vec2(16, 0), vec2(32, 0)}, vec2(16, 16), 50, true);
+    AnimationID still = assets.animation({vec2(0, 0)}, vec2(16, 16), 50, true);
+
+    AnimatedWorld() { registry.getClock().fixedDeltaTime = 0.01f; }
+
+    Registry::Entity spawn(AnimationID animation, uint16_t frame = 0) {
+        auto e = registry.create();
+        registry.emplace<Renderable>(
+            e, assets.sheet("blink.png"), animation, frame);
+        return e;
+    }
+
+    void step() { registry.update(registry.getClock().getFixedDeltaTime()); }
+};
+}  // namespace
+
+TEST(AnimationTest, FramesChangeEveryFrameDurationOfTicks) {
+    AnimatedWorld world;
+    auto e = world.spawn(world.blink);
+    world.registry.addSystem<Animation>();
+
+    std::vector<uint16_t> frames;
+    for (int i = 0; i < 16; ++i) {
+        world.step();
+        frames.push_back(world.registry.get<Renderable>(e).frame);
+    }
+
+    // Started at tick 1, then one frame every 5 ticks of 10ms
+    EXPECT_EQ(
+        frames, (std::vector<uint16_t>{
+                    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 0}));
+}
+
+TEST(AnimationTest, OnlyChangedFramesArePatched) {
+    AnimatedWorld world;
+    world.spawn(world.blink);
+    world.spawn(world.still);
+    world.registry.addSystem<Animation>();
+    int patched = 0;
+    world.registry.onUpdate<Renderable>().connect(
+        [&](Registry&, Registry::Entity) { patched++; });
+
+    for (int i = 0; i < 30; ++i) {
+        world.step();
+    }
+
+    EXPECT_EQ(patched, 5);
+}
+
+TEST(AnimationTest, ChangesAreTrackedForDeltas) {
+    AnimatedWorld world;
+    auto blinking = world.spawn(world.blink);
+    auto still = world.spawn(world.still);
+    world.registry.trackChanges<Renderable>();
+    world.registry.addSystem<Animation>();
+    for (int i = 0; i < 5; ++i) {
+        world.step();
+    }
+
+    const uint64_t since = world.registry.tick() - 1;
+    world.step();
+
+    EXPECT_EQ(
+        world.registry.changed<Renderable>(since),
+        (std::vector<Registry::Entity>{blinking}));
+    EXPECT_EQ(world.registry.changedAt<Renderable>(still), 1u);
+}
+
+TEST(AnimationTest, StartsFromTheFrameItWasCreatedWith) {
+    AnimatedWorld world;
+    world.registry.addSystem<Animation>();
+    auto e = world.spawn(world.blink, 2);
+
+    for (int i = 0; i < 6; ++i) {
+        world.step();
+    }
+
+    EXPECT_EQ(world.registry.get<Renderable>(e).frame, 0u);
+}
+
+TEST(AnimationTest, SingleFrameSpritesAreNeverScheduled) {
+    AnimatedWorld world;
+    Animation& animation = world.registry.addSystem<Animation>();
+    world.spawn(world.still);
+    world.spawn(world.blink);
+
+    world.step();
+
+    EXPECT_EQ(animation.scheduled(), 1u);
+}
+
+TEST(AnimationTest, DestroyedEntitiesLeaveTheSchedule) {
+    AnimatedWorld world;
+    Animation& animation = world.registry.addSystem<Animation>();
+    auto gone = world.spawn(world.blink);
+    auto kept = world.spawn(world.blink);
+    world.step();
+
+    world.registry.destroy(gone);
+    auto reused = world.spawn(world.still);
+    for (int i = 0; i < 5; ++i) {
+        world.step();
+    }
+
+    EXPECT_EQ(animation.scheduled(), 1u);
+    EXPECT_EQ(world.registry.get<Renderable>(kept).frame, 1u);
+    EXPECT_EQ(world.registry.get<Renderable>(reused).frame, 0u);
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include "../ecs/ArchetypeStorage.hpp"
+#include "../ecs/ComponentRegistry.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// TEST STRUCTURES
+// ============================================================================
+
+namespace {
+
+struct Coords {
+    float x, y;
+    Coords(float x = 0, float y = 0) : x(x), y(y) {}
+};
+
+struct Speed {
+    float dx, dy;
+    Speed(float dx = 0, float dy = 0) : dx(dx), dy(dy) {}
+};
+
+struct Label {
+    std::string text;
+    Label(const std::string& t = "") : text(t) {}
+};
+
+struct Counted {
+    std::shared_ptr<int> token;
+    explicit Counted(std::shared_ptr<int> t = nullptr) : token(std::move(t)) {}
+};
+
+class ArchetypeStorageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        storage.registerType<Coords>(coords);
+        storage.registerType<Speed>(speed);
+        storage.registerType<Label>(label);
+        storage.registerType<Counted>(counted);
+    }
+
+    ArchetypeStorage storage;
+    ComponentID coords = ComponentRegistry::typeID<Coords>();
+    ComponentID speed = ComponentRegistry::typeID<Speed>();
+    ComponentID label = ComponentRegistry::typeID<Label>();
+    ComponentID counted = ComponentRegistry::typeID<Counted>();
+};
+
+}  // namespace
+
+// ============================================================================
+// BASIC FUNCTIONALITY
+// ============================================================================
+
+TEST_F(ArchetypeStorageTest, EmplaceAndGet) {
+    storage.emplace<Coords>(0, coords, 1.0f, 2.0f);
+    storage.emplace<Speed>(0, speed, 3.0f, 4.0f);
+
+    EXPECT_TRUE(storage.contains(0));
+    EXPECT_FALSE(storage.contains(1));
+    EXPECT_FLOAT_EQ(storage.get<Coords>(0, coords).y, 2.0f);
+    EXPECT_FLOAT_EQ(storage.get<Speed>(0, speed).dx, 3.0f);
+    EXPECT_EQ(storage.count(coords), 1);
+    EXPECT_EQ(storage.count(speed), 1);
+}
+
+TEST_F(ArchetypeStorageTest, EmplaceTwiceKeepsExisting) {
+    storage.emplace<Coords>(0, coords, 1.0f, 2.0f);
+    Coords& again = storage.emplace<Coords>(0, coords, 9.0f, 9.0f);
+
+    EXPECT_FLOAT_EQ(again.x, 1.0f);
+    EXPECT_EQ(storage.count(coords), 1);
+}
+
+TEST_F(ArchetypeStorageTest, EntitiesWithSameComponentsShareAnArchetype) {
+    for (EntityManager::Entity e = 0; e < 10; ++e) {
+        storage.emplace<Coords>(e, coords);
+        storage.emplace<Speed>(e, speed);
+    }
+
+    // {Coords} and {Coords, Speed}
+    EXPECT_EQ(storage.archetypeCount(), 2);
+
+    size_t visited = 0;
+    ComponentSignature required;
+    required.set(coords);
+    storage.forEachMatching(required, [&](Archetype& archetype) {
+        visited += archetype.size();
+    });
+    EXPECT_EQ(visited, 10);
+}
+
+TEST_F(ArchetypeStorageTest, RemoveMovesToSmallerArchetype) {
+    storage.emplace<Coords>(0, coords, 5.0f, 6.0f);
+    storage.emplace<Label>(0, label, "player");
+
+    EXPECT_TRUE(storage.remove(0, coords));
+    EXPECT_FALSE(storage.remove(0, coords));
+    EXPECT_EQ(storage.get<Label>(0, label).text, "player");
+    EXPECT_EQ(storage.count(coords), 0);
+
+    EXPECT_TRUE(storage.remove(0, label));
+    EXPECT_FALSE(storage.contains(0));
+}
+
+TEST_F(ArchetypeStorageTest, SwapRemoveKeepsOtherEntitiesValid) {
+    for (EntityManager::Entity e = 0; e < 5; ++e) {
+        storage.emplace<Coords>(e, coords, float(e), 0.0f);
+    }
+
+    storage.destroy(1);
+
+    EXPECT_FALSE(storage.contains(1));
+    for (EntityManager::Entity e : {0u, 2u, 3u, 4u}) {
+        EXPECT_FLOAT_EQ(storage.get<Coords>(e, coords).x, float(e));
+    }
+    EXPECT_EQ(storage.count(coords), 4);
+}
+
+TEST_F(ArchetypeStorageTest, ComponentsAreDestroyed) {
+    auto token = std::make_shared<int>(0);
+
+    storage.emplace<Counted>(0, counted, token);
+    storage.emplace<Counted>(1, counted, token);
+    storage.emplace<Coords>(1, coords);
+    EXPECT_EQ(token.use_count(), 3);
+
+    storage.destroy(0);
+    EXPECT_EQ(token.use_count(), 2);
+
+    storage.clear();
+    EXPECT_EQ(token.use_count(), 1);
+    EXPECT_EQ(storage.count(counted), 0);
+}
+
+// ============================================================================
+// CHUNK LAYOUT
+// ============================================================================
+
+TEST_F(ArchetypeStorageTest, RowsSpanSeveralChunks) {
+    const EntityManager::Entity COUNT = 5000;
+    for (EntityManager::Entity e = 0; e < COUNT; ++e) {
+        storage.emplace<Coords>(e, coords, float(e), float(e));
+        storage.emplace<Speed>(e, speed, 1.0f, 1.0f);
+    }
+
+    ComponentSignature required;
+    required.set(coords);
+    required.set(speed);
+
+    size_t rows = 0;
+    storage.forEachMatching(required, [&](Archetype& archetype) {
+        EXPECT_GT(archetype.chunkCount(), 1);
+        EXPECT_LE(
+            archetype.chunkCapacity() * (sizeof(EntityManager::Entity) +
+                                         sizeof(Coords) + sizeof(Speed)),
+            Archetype::CHUNK_BYTES);
+
+        const int col = archetype.column(coords);
+        for (size_t c = 0; c < archetype.chunkCount(); ++c) {
+            auto* data = static_cast<Coords*>(archetype.columnData(c, col));
+            auto* entities = archetype.entities(c);
+            for (size_t i = 0; i < archetype.rowsIn(c); ++i) {
+                EXPECT_FLOAT_EQ(data[i].x, float(entities[i]));
+                rows++;
+            }
+        }
+    });
+    EXPECT_EQ(rows, COUNT);
+    EXPECT_GT(storage.memoryUsage(), 0);
+}
+
+TEST_F(ArchetypeStorageTest, ColumnsAreAligned) {
+    storage.emplace<Label>(0, label, "aligned");
+    storage.emplace<Coords>(0, coords);
+
+    ComponentSignature required;
+    required.set(label);
+    storage.forEachMatching(required, [&](Archetype& archetype) {
+        auto address = reinterpret_cast<std::uintptr_t>(
+            archetype.columnData(0, archetype.column(label)));
+        EXPECT_EQ(address % alignof(Label), 0u);
+    });
+}
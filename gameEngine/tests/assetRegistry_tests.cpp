@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "../ecs/Registry.hpp"
+#include "../components/renderable/src/Renderable.hpp"
+#include "../systems/animation/src/Animation.hpp"
+#include <vector>
+
+using namespace GameEngine;
+
+// ============================================================================
+// INTERNING
+// ============================================================================
+
+TEST(AssetRegistryTest, IdZeroIsTheEmptyAsset) {
+    AssetRegistry assets;
+    Renderable render;
+
+    EXPECT_EQ(assets.sheetPath(render.sheet), "");
+    EXPECT_TRUE(assets.animation(render.animation).frames.empty());
+    EXPECT_EQ(assets.sheetCount(), 1u);
+    EXPECT_EQ(assets.animationCount(), 1u);
+}
+
+TEST(AssetRegistryTest, SheetsAreInternedOnce) {
+    AssetRegistry assets;
+
+    SheetID player = assets.sheet("assets/sprites/player.png");
+    SheetID enemy = assets.sheet("assets/sprites/enemy.png");
+
+    EXPECT_NE(player, enemy);
+    EXPECT_EQ(assets.sheet("assets/sprites/player.png"), player);
+    EXPECT_EQ(assets.sheetPath(enemy), "assets/sprites/enemy.png");
+    EXPECT_EQ(assets.sheetCount(), 3u);
+}
+
+TEST(AssetRegistryTest, IdenticalTablesShareAnId) {
+    AssetRegistry assets;
+    std::vector<vec2> frames{vec2(0, 0), vec2(19, 0), vec2(38, 0)};
+
+    AnimationID shot = assets.animation(frames, vec2(22, 22), 50, true);
+    AnimationID slower = assets.animation(frames, vec2(22, 22), 100, true);
+
+    EXPECT_NE(shot, slower);
+    EXPECT_EQ(assets.animation(frames, vec2(22, 22), 50, true), shot);
+    EXPECT_EQ(assets.animation(shot).frames.size(), 3u);
+    EXPECT_FLOAT_EQ(assets.animation(shot).frames[2].x, 38.0f);
+    EXPECT_EQ(assets.animation(slower).frameDuration, 100);
+    EXPECT_EQ(assets.animationCount(), 3u);
+}
+
+// ============================================================================
+// RENDERABLE
+// ============================================================================
+
+TEST(AssetRegistryTest, RenderableIsCompact) {
+    EXPECT_TRUE(isTrivialComponent<Renderable>);
+    EXPECT_EQ(sizeof(Renderable), 3 * sizeof(uint16_t));
+}
+
+TEST(AssetRegistryTest, AnimationPicksFramesFromTheTable) {
+    Registry registry;
+    auto& assets = registry.resources().getOrEmplace<AssetRegistry>();
+    AnimationID walk = assets.animation(
+        {vec2(0, 0), vec2(32, 0), vec2(64, 0)}, vec2(32, 32), 1, true);
+    auto walker = registry.create();
+    auto still = registry.create();
+    registry.emplace<Renderable>(walker, assets.sheet("walk.png"), walk);
+    registry.emplace<Renderable>(still);
+    registry.addSystem<Animation>();
+
+    for (int i = 0; i < 4; ++i) {
+        registry.update(registry.getClock().getFixedDeltaTime());
+    }
+
+    EXPECT_NE(registry.get<Renderable>(walker).frame, 0u);
+    EXPECT_LT(registry.get<Renderable>(walker).frame, 3u);
+    EXPECT_EQ(registry.get<Renderable>(still).frame, 0u);
+}
@@ -0,0 +1,397 @@
+#include <gtest/gtest.h>
+#include "../ecs/Registry.hpp"
+#include "../systems/applyDamage/src/ApplyDamage.hpp"
+#include "../systems/collision/src/Collision.hpp"
+#include "../systems/collision/src/CollisionKernel.hpp"
+#include "../systems/pickup/src/Pickup.hpp"
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace GameEngine;
+
+namespace {
+/// Registry running Collision and its readers over colliders spawned by the
+/// tests
+struct CollidingWorld {
+    Registry registry;
+
+    explicit CollidingWorld(float cellSize = 64.0f) {
+        registry.addSystem<Collision>(0, cellSize);
+        registry.addSystem<ApplyDamage>(1);
+        registry.addSystem<Pickup>(2);
+    }
+
+    Registry::Entity spawn(
+        vec2 pos, vec2 size, int hp = 100, int dmg = 1,
+        std::bitset<8> selector = 0b01, std::bitset<8> diff = 0b01) {
+        auto e = registry.create();
+        registry.emplace<Position>(e, pos.x, pos.y);
+        registry.emplace<Renderable>(e);
+        registry.emplace<Collider>(e, vec2(0, 0), selector, diff, size);
+        registry.emplace<Damage>(e, dmg);
+        registry.emplace<Health>(e, float(hp), float(hp));
+        return e;
+    }
+
+    int hp(Registry::Entity e) { return registry.get<Health>(e).currentHp; }
+
+    const std::vector<Contact>& contacts() {
+        return registry.resources().get<Contacts>().latest();
+    }
+
+    void step() { registry.update(registry.getClock().getFixedDeltaTime()); }
+};
+
+/// Random hitboxes, as arrays, with a few NaN and touching edges
+struct HitboxSoA {
+    std::vector<float> minX, minY, maxX, maxY;
+    std::vector<uint8_t> selector, diff;
+
+    HitboxSoA(size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> coord(0.f, 200.f);
+        std::uniform_real_distribution<float> extent(1.f, 60.f);
+        std::uniform_int_distribution<int> layers(0, 255);
+        for (size_t i = 0; i < count; ++i) {
+            minX.push_back(coord(rng));
+            minY.push_back(coord(rng));
+            maxX.push_back(minX.back() + extent(rng));
+            maxY.push_back(minY.back() + extent(rng));
+            selector.push_back(static_cast<uint8_t>(layers(rng)));
+            diff.push_back(static_cast<uint8_t>(layers(rng)));
+        }
+        if (count > 4) {
+            minX[1] = NAN;
+            maxY[2] = 100.f;
+            minX[3] = 130.f;
+        }
+    }
+
+    HitboxArrays arrays() const {
+        return {minX.data(), minY.data(), maxX.data(), maxY.data(),
+                selector.data(), diff.data(), nullptr, minX.size()};
+    }
+};
+}  // namespace
+
+// ============================================================================
+// NARROWPHASE KERNEL
+// ============================================================================
+
+TEST(CollisionKernelTest, VectorMatchesScalar) {
+    const Hitbox probes[] = {
+        {50.f, 50.f, 130.f, 100.f, 0xFF, 0xFF},
+        {0.f, 0.f, 260.f, 260.f, 0b0101, 0b0011},
+        {NAN, 0.f, 200.f, 200.f, 0xFF, 0xFF},
+    };
+
+    // Odd counts and offsets so the scalar tail runs too
+    for (size_t count : {0u, 5u, 8u, 37u, 1001u}) {
+        HitboxSoA boxes(count, 42);
+        for (const Hitbox& probe : probes) {
+            for (size_t first : {size_t(0), size_t(3)}) {
+                if (first > count)
+                    continue;
+                std::vector<uint32_t> vector(count), scalar(count);
+                const size_t found = overlapHitboxes(
+                    probe, boxes.arrays(), first, vector.data());
+                const size_t expected = overlapHitboxesScalar(
+                    probe, boxes.arrays(), first, scalar.data());
+
+                ASSERT_EQ(found, expected) << count << " from " << first;
+                vector.resize(found);
+                scalar.resize(expected);
+                EXPECT_EQ(vector, scalar) << count << " from " << first;
+            }
+        }
+    }
+}
+
+TEST(CollisionKernelTest, LayersAndEdgesFilterPairs) {
+    HitboxSoA boxes(0, 0);
+    auto push = [&](float x, uint8_t selector, uint8_t diff) {
+        boxes.minX.push_back(x);
+        boxes.minY.push_back(0.f);
+        boxes.maxX.push_back(x + 10.f);
+        boxes.maxY.push_back(10.f);
+        boxes.selector.push_back(selector);
+        boxes.diff.push_back(diff);
+    };
+    for (int i = 0; i < 3; ++i) {
+        push(5.f, 0b10, 0b01);   // Hit
+        push(5.f, 0b10, 0b10);   // Ignores the probe's layer
+        push(5.f, 0b01, 0b01);   // Not in a layer the probe hits
+        push(10.f, 0b10, 0b01);  // Touches the probe's edge
+    }
+    const Hitbox probe{0.f, 0.f, 10.f, 10.f, 0b01, 0b10};
+
+    std::vector<uint32_t> found(boxes.minX.size());
+    found.resize(overlapHitboxes(probe, boxes.arrays(), 0, found.data()));
+
+    EXPECT_EQ(found, (std::vector<uint32_t>{0, 4, 8}));
+}
+
+TEST(CollisionKernelTest, FlagsMustHaveEveryNeededBit) {
+    HitboxSoA boxes(11, 3);
+    std::fill(boxes.minX.begin(), boxes.minX.end(), 0.f);
+    std::fill(boxes.minY.begin(), boxes.minY.end(), 0.f);
+    std::fill(boxes.maxX.begin(), boxes.maxX.end(), 10.f);
+    std::fill(boxes.maxY.begin(), boxes.maxY.end(), 10.f);
+    std::fill(boxes.selector.begin(), boxes.selector.end(), 1);
+    std::fill(boxes.diff.begin(), boxes.diff.end(), 1);
+    std::vector<uint8_t> flags;
+    for (size_t i = 0; i < boxes.minX.size(); ++i) {
+        flags.push_back(static_cast<uint8_t>(i % 4));
+    }
+    HitboxArrays arrays = boxes.arrays();
+    arrays.flags = flags.data();
+    const Hitbox probe{5.f, 5.f, 6.f, 6.f, 1, 1};
+
+    std::vector<uint32_t> found(flags.size()), scalar(flags.size());
+    found.resize(overlapHitboxes(probe, arrays, 0, found.data(), 0b10));
+    scalar.resize(
+        overlapHitboxesScalar(probe, arrays, 0, scalar.data(), 0b10));
+
+    EXPECT_EQ(found, (std::vector<uint32_t>{2, 3, 6, 7, 10}));
+    EXPECT_EQ(scalar, found);
+}
+
+// ============================================================================
+// COLLISION SYSTEM
+// ============================================================================
+
+TEST(CollisionTest, OverlappingPairHitsEachOtherOnce) {
+    CollidingWorld world;
+    // Both span four cells of 64px
+    auto a = world.spawn(vec2(40, 40), vec2(100, 100), 100, 3);
+    auto b = world.spawn(vec2(60, 60), vec2(100, 100), 100, 5);
+    auto apart = world.spawn(vec2(400, 400), vec2(10, 10));
+
+    world.step();
+
+    EXPECT_EQ(world.hp(a), 95);
+    EXPECT_EQ(world.hp(b), 97);
+    EXPECT_EQ(world.hp(apart), 100);
+}
+
+TEST(CollisionTest, TouchingEdgesDoNotCollide) {
+    CollidingWorld world;
+    auto a = world.spawn(vec2(0, 0), vec2(64, 64));
+    auto b = world.spawn(vec2(64, 0), vec2(64, 64));
+
+    world.step();
+
+    EXPECT_EQ(world.hp(a), 100);
+    EXPECT_EQ(world.hp(b), 100);
+}
+
+TEST(CollisionTest, LayersMustMatchBothWays) {
+    CollidingWorld world;
+    auto player = world.spawn(vec2(10, 10), vec2(20, 20), 10, 1, 0b001, 0b110);
+    auto enemy = world.spawn(vec2(15, 15), vec2(20, 20), 10, 1, 0b010, 0b001);
+    auto deaf = world.spawn(vec2(20, 20), vec2(20, 20), 10, 1, 0b100, 0b000);
+
+    world.step();
+
+    EXPECT_EQ(world.hp(player), 9);
+    EXPECT_EQ(world.hp(enemy), 9);
+    EXPECT_EQ(world.hp(deaf), 10);
+}
+
+TEST(CollisionTest, HitboxesOffScreenStillCollide) {
+    CollidingWorld world;
+    auto a = world.spawn(vec2(4000, 3000), vec2(20, 20));
+    auto b = world.spawn(vec2(4010, 3010), vec2(20, 20));
+    auto border = world.spawn(vec2(1910, 1070), vec2(5, 5));
+
+    world.step();
+
+    EXPECT_EQ(world.hp(a), 99);
+    EXPECT_EQ(world.hp(b), 99);
+    EXPECT_EQ(world.hp(border), 100);
+}
+
+TEST(CollisionTest, FarOutliersDoNotHideNearbyPairs) {
+    CollidingWorld world;
+    auto a = world.spawn(vec2(10, 10), vec2(20, 20));
+    auto b = world.spawn(vec2(25, 25), vec2(20, 20));
+    auto c = world.spawn(vec2(40, 40), vec2(20, 20));
+    auto far = world.spawn(vec2(1e7f, 1e7f), vec2(20, 20));
+
+    world.step();
+
+    EXPECT_EQ(world.hp(a), 99);
+    EXPECT_EQ(world.hp(b), 98);
+    EXPECT_EQ(world.hp(c), 99);
+    EXPECT_EQ(world.hp(far), 100);
+}
+
+TEST(CollisionTest, NegativePositionsAreIgnored) {
+    CollidingWorld world;
+    auto a = world.spawn(vec2(-5, 10), vec2(20, 20));
+    auto b = world.spawn(vec2(0, 10), vec2(20, 20));
+
+    world.step();
+
+    EXPECT_EQ(world.hp(a), 100);
+    EXPECT_EQ(world.hp(b), 100);
+}
+
+TEST(CollisionTest, DeadEntitiesAreNotHitAgain) {
+    CollidingWorld world;
+    auto victim = world.spawn(vec2(10, 10), vec2(20, 20), 1);
+    world.spawn(vec2(12, 12), vec2(20, 20));
+    world.spawn(vec2(14, 14), vec2(20, 20));
+
+    int updates = 0;
+    world.registry.onUpdate<Health>().connect(
+        [&](Registry&, Registry::Entity e) { updates += e == victim; });
+    world.step();
+
+    EXPECT_EQ(world.hp(victim), 0);
+    EXPECT_EQ(updates, 1);
+}
+
+TEST(CollisionTest, MatchesBruteForceForAnyCellSize) {
+    struct Box {
+        vec2 pos, size;
+        int dmg;
+    };
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coord(0.0f, 2200.0f);
+    std::uniform_real_distribution<float> extent(4.0f, 150.0f);
+    std::uniform_int_distribution<int> damage(1, 4);
+    std::vector<Box> boxes;
+    for (int i = 0; i < 400; ++i) {
+        boxes.push_back(
+            {vec2(coord(rng), coord(rng)), vec2(extent(rng), extent(rng)),
+             damage(rng)});
+    }
+
+    // Every overlapping pair hits once; 1000 HP keeps everyone alive
+    std::vector<int> expected(boxes.size(), 1000);
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        for (size_t j = i + 1; j < boxes.size(); ++j) {
+            const Box& a = boxes[i];
+            const Box& b = boxes[j];
+            if (a.pos.x < b.pos.x + b.size.x && b.pos.x < a.pos.x + a.size.x &&
+                a.pos.y < b.pos.y + b.size.y && b.pos.y < a.pos.y + a.size.y) {
+                expected[i] -= b.dmg;
+                expected[j] -= a.dmg;
+            }
+        }
+    }
+
+    for (float cellSize : {16.0f, 64.0f, 500.0f, 4000.0f}) {
+        CollidingWorld world(cellSize);
+        std::vector<Registry::Entity> entities;
+        for (const Box& box : boxes) {
+            entities.push_back(world.spawn(box.pos, box.size, 1000, box.dmg));
+        }
+        world.step();
+
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            EXPECT_EQ(world.hp(entities[i]), expected[i])
+                << "cell size " << cellSize << ", box " << i;
+        }
+    }
+}
+
+// ============================================================================
+// CONTACTS
+// ============================================================================
+
+TEST(CollisionTest, ContactsCarryLayersAndDamage) {
+    CollidingWorld world;
+    auto a = world.spawn(vec2(10, 10), vec2(20, 20), 100, 3, 0b011, 0b001);
+    auto b = world.spawn(vec2(20, 25), vec2(20, 20), 100, 7, 0b001, 0b011);
+
+    world.step();
+
+    ASSERT_EQ(world.contacts().size(), 1u);
+    Contact contact = world.contacts()[0];
+    if (contact.first != a) {
+        std::swap(contact.first, contact.second);
+        std::swap(contact.firstLayers, contact.secondLayers);
+        std::swap(contact.firstDamage, contact.secondDamage);
+    }
+    EXPECT_EQ(contact.first, a);
+    EXPECT_EQ(contact.second, b);
+    EXPECT_EQ(contact.firstLayers, 0b011);
+    EXPECT_EQ(contact.secondLayers, 0b001);
+    EXPECT_EQ(contact.firstDamage, 3);
+    EXPECT_EQ(contact.secondDamage, 7);
+}
+
+TEST(CollisionTest, CollisionAloneLeavesHealthAlone) {
+    Registry registry;
+    registry.addSystem<Collision>();
+    for (float x : {10.f, 15.f}) {
+        auto e = registry.create();
+        registry.emplace<Position>(e, x, 10.f);
+        registry.emplace<Renderable>(e);
+        registry.emplace<Collider>(e, vec2(0, 0), 1, 1, vec2(20, 20));
+        registry.emplace<Damage>(e, 5);
+        registry.emplace<Health>(e, 10.f, 10.f);
+    }
+
+    registry.update(registry.getClock().getFixedDeltaTime());
+
+    EXPECT_EQ(registry.resources().get<Contacts>().latest().size(), 1u);
+    registry.each<Health>(
+        [](auto, Health& health) { EXPECT_EQ(health.currentHp, 10); });
+}
+
+TEST(CollisionTest, ContactsOfAStepAreAppliedOnce) {
+    CollidingWorld world;
+    auto a = world.spawn(vec2(10, 10), vec2(20, 20), 100, 3);
+    auto b = world.spawn(vec2(15, 15), vec2(20, 20), 100, 4);
+
+    world.step();
+    world.step();
+
+    EXPECT_EQ(world.registry.resources().get<Contacts>().size(), 2u);
+    EXPECT_EQ(world.hp(a), 92);
+    EXPECT_EQ(world.hp(b), 94);
+}
+
+TEST(CollisionTest, PickupsBoostTheFirstCollectorAndVanish) {
+    CollidingWorld world;
+    auto player = world.spawn(vec2(10, 10), vec2(20, 20), 50, 2);
+    world.registry.emplace<FireRate>(player, 0.5f);
+    auto other = world.spawn(vec2(30, 10), vec2(20, 20), 50, 2);
+    // Touches both players, deals no damage
+    auto bonus = world.spawn(vec2(25, 10), vec2(10, 10), 1, 0);
+    world.registry.emplace<OnPickup>(bonus, 80, 20, 3, 0.2f);
+
+    world.step();
+
+    EXPECT_FALSE(world.registry.valid(bonus));
+    const bool playerFirst = world.registry.get<Health>(player).maxHp == 70;
+    auto collector = playerFirst ? player : other;
+    auto bystander = playerFirst ? other : player;
+    EXPECT_EQ(world.hp(collector), 70);
+    EXPECT_EQ(world.registry.get<Health>(collector).maxHp, 70);
+    EXPECT_EQ(world.registry.get<Damage>(collector).dmg, 5);
+    EXPECT_EQ(world.hp(bystander), 50);
+    EXPECT_EQ(world.registry.get<Damage>(bystander).dmg, 2);
+    if (playerFirst) {
+        EXPECT_FLOAT_EQ(world.registry.get<FireRate>(player).fireRate, 0.3f);
+    }
+}
+
+TEST(CollisionTest, DeadEntitiesDoNotCollect) {
+    CollidingWorld world;
+    auto player = world.spawn(vec2(10, 10), vec2(20, 20), 0);
+    auto bonus = world.spawn(vec2(15, 15), vec2(10, 10), 1, 0);
+    world.registry.emplace<OnPickup>(bonus, 10);
+
+    world.step();
+
+    EXPECT_TRUE(world.registry.valid(bonus));
+    EXPECT_EQ(world.hp(player), 0);
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "../ecs/ComponentRegistry.hpp"
 #include <chrono>
+#include <thread>
+#include <vector>
 
 // test composant
 struct Transform { float x, y, z; };
@@ -41,6 +43,45 @@ TEST(ComponentRegistryTest, GetOrCreateIDIsCached) {
     EXPECT_EQ(id2, id3);
 }
 
+TEST(ComponentRegistryTest, TypeIDMatchesGetOrCreateID) {
+    auto& reg = ComponentRegistry::instance();
+
+    EXPECT_EQ(ComponentRegistry::typeID<Armor>(), reg.getOrCreateID<Armor>());
+    EXPECT_EQ(ComponentRegistry::typeID<const Armor>(),
+              ComponentRegistry::typeID<Armor>());
+}
+
+TEST(ComponentRegistryTest, ConcurrentFirstUseAssignsSingleID) {
+    struct ConcurrentA {};
+    struct ConcurrentB {};
+    const size_t THREADS = 8;
+
+    std::vector<ComponentID> idsA(THREADS);
+    std::vector<ComponentID> idsB(THREADS);
+    std::vector<ComponentID> idsByName(THREADS);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            idsA[t] = ComponentRegistry::typeID<ConcurrentA>();
+            idsByName[t] =
+                ComponentRegistry::instance().getOrCreateID("ConcurrentName");
+            idsB[t] = ComponentRegistry::typeID<ConcurrentB>();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t t = 1; t < THREADS; ++t) {
+        EXPECT_EQ(idsA[t], idsA[0]);
+        EXPECT_EQ(idsB[t], idsB[0]);
+        EXPECT_EQ(idsByName[t], idsByName[0]);
+    }
+    EXPECT_NE(idsA[0], idsB[0]);
+    EXPECT_NE(idsA[0], idsByName[0]);
+    EXPECT_NE(idsB[0], idsByName[0]);
+}
+
 // --- Tests string-based ---
 
 TEST(ComponentRegistryTest, StringBasedRegistration) {
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "../components/AIControlled/src/AIControlled.hpp"
+#include "../components/acceleration/src/Acceleration.hpp"
+#include "../components/collider/src/Collider.hpp"
+#include "../components/health/src/Health.hpp"
+#include "../components/position/src/Position.hpp"
+#include "../components/renderable/src/Renderable.hpp"
+#include "../components/velocity/src/Velocity.hpp"
+#include <cstring>
+#include <memory>
+#include <string>
+
+using namespace GameEngine;
+
+// ============================================================================
+// LAYOUT
+// ============================================================================
+
+TEST(ComponentTest, PlainComponentsCarryNoVtable) {
+    EXPECT_EQ(sizeof(Position), sizeof(vec2));
+    EXPECT_EQ(sizeof(Velocity), 3 * sizeof(float));
+    EXPECT_EQ(sizeof(Health), 2 * sizeof(int));
+    EXPECT_FALSE(std::is_polymorphic_v<Position>);
+}
+
+TEST(ComponentTest, PlainComponentsAreTrivial) {
+    EXPECT_TRUE(isTrivialComponent<Position>);
+    EXPECT_TRUE(isTrivialComponent<Velocity>);
+    EXPECT_TRUE(isTrivialComponent<Acceleration>);
+    EXPECT_TRUE(isTrivialComponent<Collider>);
+    EXPECT_TRUE(isTrivialComponent<Renderable>);
+}
+
+TEST(ComponentTest, DataLessComponentsAreTags) {
+    EXPECT_TRUE(isTagComponent<AIControlled>);
+    EXPECT_FALSE(isTagComponent<Position>);
+    EXPECT_FALSE(isTagComponent<Velocity>);
+}
+
+TEST(ComponentTest, TrivialComponentsCopyWithMemcpy) {
+    Velocity source(250.f, 3.f, -4.f);
+    Velocity copy;
+    std::memcpy(&copy, &source, sizeof(Velocity));
+
+    EXPECT_FLOAT_EQ(copy.speedMax, 250.f);
+    EXPECT_FLOAT_EQ(copy.x, 3.f);
+    EXPECT_FLOAT_EQ(copy.y, -4.f);
+}
+
+// ============================================================================
+// METADATA
+// ============================================================================
+
+TEST(ComponentTest, TraitsExposeNameAndVersion) {
+    EXPECT_STREQ(ComponentTraits<Position>::name(), "Position");
+    EXPECT_STREQ(ComponentTraits<Position>::version(), "1.0.0");
+    EXPECT_STREQ(Position::getComponentName(), "Position");
+}
+
+struct Unnamed : Component<Unnamed> {
+    int value = 0;
+};
+
+template <>
+struct ComponentTraits<Unnamed> {
+    static constexpr const char* name() {
+        return "Unnamed";
+    }
+    static constexpr const char* version() {
+        return "2.0.0";
+    }
+    static Unnamed clone(const Unnamed& component) {
+        return component;
+    }
+};
+
+TEST(ComponentTest, TraitsCanBeSpecialized) {
+    ComponentBox<Unnamed> box;
+
+    EXPECT_STREQ(box.getComponentName(), "Unnamed");
+    EXPECT_STREQ(box.getVersion(), "2.0.0");
+}
+
+TEST(ComponentTest, BoxWrapsAComponentForPlugins) {
+    std::unique_ptr<IComponent> box =
+        std::make_unique<ComponentBox<Position>>(Position(3.f, 4.f));
+    std::unique_ptr<IComponent> copy = box->clone();
+    static_cast<Position*>(box->data())->pos.x = 10.f;
+
+    EXPECT_STREQ(copy->getComponentName(), "Position");
+    EXPECT_FLOAT_EQ(static_cast<Position*>(copy->data())->pos.x, 3.f);
+    EXPECT_FLOAT_EQ(static_cast<Position*>(copy->data())->pos.y, 4.f);
+}
@@ -1,6 +1,14 @@
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+#include <thread>
 #include <vector>
 #include <bitset>
+#include <utility>
 
 #include "../ecs/Registry.hpp"
 #include "../ecs/EntityManager.hpp"
@@ -27,7 +35,32 @@ struct HealthSimple {
 #include "../components/damage/src/Damage.hpp"
 #include "../components/health/src/Health.hpp"
 #include "../components/renderable/src/Renderable.hpp"
+#include "../systems/animation/src/Animation.hpp"
+#include "../systems/applyDamage/src/ApplyDamage.hpp"
 #include "../systems/collision/src/Collision.hpp"
+#include "../systems/collision/src/CollisionKernel.hpp"
+#include "../systems/motion/src/Motion.hpp"
+
+// -----------------------------------------------------------------------------
+// Compteur d'allocations : toutes les allocations du process passent par ici
+// -----------------------------------------------------------------------------
+static std::atomic<std::size_t> heapAllocations{0};
+
+void* operator new(std::size_t size) {
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    Profiler::countAllocation();
+    if (void* memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
 
 // -----------------------------------------------------------------------------
 // EntityManager create/destroy
@@ -83,6 +116,45 @@ BENCHMARK(BM_Registry_CreateDestroyManyEntities)
     ->Args({5'000'000})
     ->Args({10'000'000});
 
+// -----------------------------------------------------------------------------
+// Registry destroy with many component types registered
+// (each entity only uses two of them)
+// -----------------------------------------------------------------------------
+template <int N>
+struct FillerComponent {
+    int value = N;
+};
+
+template <int... Ns>
+static void registerFillerPools(Registry& registry, std::integer_sequence<int, Ns...>) {
+    auto e = registry.create();
+    (registry.emplace<FillerComponent<Ns>>(e), ...);
+}
+
+static void BM_Registry_DestroyWithManyComponentTypes(benchmark::State& state) {
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        Registry registry;
+        registerFillerPools(registry, std::make_integer_sequence<int, 32>{});
+        std::vector<Registry::Entity> entities;
+        entities.reserve(COUNT);
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            auto e = registry.create();
+            registry.emplace<Position>(e);
+            registry.emplace<Velocity>(e);
+            entities.push_back(e);
+        }
+        for (auto e : entities) {
+            registry.destroy(e);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Registry_DestroyWithManyComponentTypes)
+    ->Args({1'000})
+    ->Args({10'000})
+    ->Args({100'000});
+
 // -----------------------------------------------------------------------------
 // Emplace Position (simple ECS test)
 // -----------------------------------------------------------------------------
@@ -179,6 +251,478 @@ BENCHMARK(BM_Registry_MixedComponentIteration)
     ->Args({5'000'000})
     ->Args({10'000'000});
 
+// -----------------------------------------------------------------------------
+// Random access through Registry::get (type ID + pool + sparse lookup)
+// -----------------------------------------------------------------------------
+static void BM_Registry_GetPosition(benchmark::State& state) {
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(0));
+    Registry registry;
+    std::vector<Registry::Entity> entities;
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        auto e = registry.create();
+        registry.emplace<Position>(e, static_cast<float>(i));
+        entities.push_back(e);
+    }
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (auto e : entities) {
+            if (registry.has<Position>(e)) {
+                sum += registry.get<Position>(e).x;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(BM_Registry_GetPosition)
+    ->Args({1'000})
+    ->Args({100'000});
+
+// -----------------------------------------------------------------------------
+// Group iteration (owned Position/Velocity, maintained on emplace)
+// -----------------------------------------------------------------------------
+static void BM_Registry_Group_PositionVelocity(benchmark::State& state) {
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        Registry registry;
+        auto& group = registry.group<Position, Velocity>();
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            auto e = registry.create();
+            registry.emplace<Position>(e, 0.0f, 0.0f, 0.0f);
+            registry.emplace<Velocity>(e, 1.0f, 1.0f, 1.0f);
+        }
+        group.each([](auto, Position& pos, Velocity& vel) {
+            pos.x += vel.vx;
+            pos.y += vel.vy;
+            pos.z += vel.vz;
+        });
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Registry_Group_PositionVelocity)
+    ->Args({1'000})
+    ->Args({10'000})
+    ->Args({100'000})
+    ->Args({1'000'000});
+
+static void BM_Registry_Group_MixedComponentIteration(benchmark::State& state) {
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        Registry registry;
+        auto& group = registry.group<Velocity>(observe<Position>);
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            auto e = registry.create();
+            registry.emplace<Position>(e);
+            if (i % 2 == 0) {
+                registry.emplace<Velocity>(e);
+            }
+            if (i % 3 == 0) {
+                registry.emplace<HealthSimple>(e, 100);
+            }
+        }
+        int count = 0;
+        group.each([&](auto, Velocity&, Position&) {
+            ++count;
+        });
+        benchmark::DoNotOptimize(count);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Registry_Group_MixedComponentIteration)
+    ->Args({1'000})
+    ->Args({10'000})
+    ->Args({100'000})
+    ->Args({1'000'000});
+
+// -----------------------------------------------------------------------------
+// Steady-state iteration only: each() vs group() over the same population
+// -----------------------------------------------------------------------------
+static void populateMixed(Registry& registry, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        auto e = registry.create();
+        registry.emplace<Position>(e);
+        if (i % 2 == 0) {
+            registry.emplace<Velocity>(e, 1.0f, 1.0f, 1.0f);
+        }
+        if (i % 3 == 0) {
+            registry.emplace<HealthSimple>(e, 100);
+        }
+    }
+}
+
+static void BM_Registry_Iterate_Each(benchmark::State& state) {
+    Registry registry;
+    populateMixed(registry, static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        registry.each<Position, Velocity, HealthSimple>(
+            [](auto, Position& pos, Velocity& vel, HealthSimple&) {
+                pos.x += vel.vx;
+                pos.y += vel.vy;
+            });
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Registry_Iterate_Each)
+    ->Args({10'000})
+    ->Args({100'000})
+    ->Args({1'000'000});
+
+static void BM_Registry_Iterate_Group(benchmark::State& state) {
+    Registry registry;
+    auto& group =
+        registry.group<Velocity, HealthSimple>(observe<Position>);
+    populateMixed(registry, static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        group.each([](auto, Velocity& vel, HealthSimple&, Position& pos) {
+            pos.x += vel.vx;
+            pos.y += vel.vy;
+        });
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Registry_Iterate_Group)
+    ->Args({10'000})
+    ->Args({100'000})
+    ->Args({1'000'000});
+
+// -----------------------------------------------------------------------------
+// Position without Velocity nor HealthSimple: has() per entity (0) vs
+// exclude<> (1)
+// -----------------------------------------------------------------------------
+static void BM_Registry_Each_Exclude(benchmark::State& state) {
+    Registry registry;
+    populateMixed(registry, static_cast<std::size_t>(state.range(1)));
+    const Registry& reader = registry;
+    for (auto _ : state) {
+        if (state.range(0) == 0) {
+            registry.each<Position>([&](auto e, Position& pos) {
+                if (!reader.has<Velocity>(e) && !reader.has<HealthSimple>(e)) {
+                    pos.x += 1.0f;
+                }
+            });
+        } else {
+            registry.each<Position>(
+                exclude<Velocity, HealthSimple>,
+                [](auto, Position& pos) { pos.x += 1.0f; });
+        }
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Registry_Each_Exclude)
+    ->ArgsProduct({{0, 1}, {100'000, 1'000'000}});
+
+// -----------------------------------------------------------------------------
+// Joined iteration once the pools have drifted apart: unsorted (0) vs
+// Velocity co-ordered with Position (1)
+// -----------------------------------------------------------------------------
+static void BM_Registry_Each_CoOrdered(benchmark::State& state) {
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(1));
+    Registry registry;
+    std::vector<Registry::Entity> entities(COUNT);
+    for (auto& e : entities) {
+        e = registry.create();
+        registry.emplace<Position>(e);
+    }
+    std::mt19937 rng(42);
+    std::shuffle(entities.begin(), entities.end(), rng);
+    for (auto e : entities) {
+        registry.emplace<Velocity>(e, 1.0f, 1.0f, 1.0f);
+    }
+    if (state.range(0) == 1) {
+        registry.sort<Velocity, Position>();
+    }
+
+    for (auto _ : state) {
+        registry.each<Position, Velocity>(
+            [](auto, Position& pos, Velocity& vel) {
+                pos.x += vel.vx;
+                pos.y += vel.vy;
+            });
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Registry_Each_CoOrdered)
+    ->ArgsProduct({{0, 1}, {100'000, 1'000'000}});
+
+// -----------------------------------------------------------------------------
+// Spawning projectiles: one emplace per component (0), Prefab one at a time
+// (1), Prefab batch of `count` (2)
+// -----------------------------------------------------------------------------
+static void BM_Registry_SpawnProjectiles(benchmark::State& state) {
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(1));
+    GameEngine::AssetRegistry assets;
+    Prefab projectile;
+    projectile
+        .with<GameEngine::Renderable>(
+            assets.sheet("assets/sprites/playerProjectiles.png"),
+            assets.animation(
+                {{0.0F, 0.0F}, {19.0F, 0.0F}, {38.0F, 0.0F}},
+                vec2{22.28f, 22.28f}, 50, true))
+        .with<GameEngine::Health>(1.f, 1.f)
+        .with<GameEngine::Damage>(1)
+        .with<GameEngine::Collider>(
+            vec2(0.0, 0.0), std::bitset<8>("01000000"),
+            std::bitset<8>("00100000"), vec2(44.56, 44.56));
+
+    for (auto _ : state) {
+        Registry registry;
+        if (state.range(0) == 0) {
+            for (std::size_t i = 0; i < COUNT; ++i) {
+                auto e = registry.create();
+                registry.emplace<GameEngine::Renderable>(
+                    e, assets.sheet("assets/sprites/playerProjectiles.png"),
+                    assets.animation(
+                        {{0.0F, 0.0F}, {19.0F, 0.0F}, {38.0F, 0.0F}},
+                        vec2{22.28f, 22.28f}, 50, true));
+                registry.emplace<GameEngine::Health>(e, 1.f, 1.f);
+                registry.emplace<GameEngine::Damage>(e, 1);
+                registry.emplace<GameEngine::Position>(e, float(i), 0.f);
+                registry.emplace<GameEngine::Collider>(
+                    e, vec2(0.0, 0.0), std::bitset<8>("01000000"),
+                    std::bitset<8>("00100000"), vec2(44.56, 44.56));
+            }
+        } else if (state.range(0) == 1) {
+            for (std::size_t i = 0; i < COUNT; ++i) {
+                registry.spawn(projectile, [&](Registry::Entity e) {
+                    registry.emplace<GameEngine::Position>(e, float(i), 0.f);
+                });
+            }
+        } else {
+            registry.spawn(
+                projectile, COUNT, [&](Registry::Entity e, std::size_t i) {
+                    registry.emplace<GameEngine::Position>(e, float(i), 0.f);
+                });
+        }
+        benchmark::DoNotOptimize(registry.alive());
+    }
+}
+BENCHMARK(BM_Registry_SpawnProjectiles)
+    ->ArgsProduct({{0, 1, 2}, {1'000, 100'000}});
+
+// -----------------------------------------------------------------------------
+// Spawning while iterating: direct calls vs deferred command buffer
+// -----------------------------------------------------------------------------
+static void BM_Registry_SpawnDuringIteration_Direct(benchmark::State& state) {
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        Registry registry;
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            registry.emplace<HealthSimple>(registry.create(), 100);
+        }
+        std::vector<Registry::Entity> spawned;
+        registry.each<HealthSimple>([&](auto, HealthSimple&) {
+            spawned.push_back(registry.create());
+        });
+        for (auto e : spawned) {
+            registry.emplace<Position>(e);
+            registry.emplace<Velocity>(e, 1.0f);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Registry_SpawnDuringIteration_Direct)
+    ->Args({1'000})
+    ->Args({10'000})
+    ->Args({100'000});
+
+static void BM_Registry_SpawnDuringIteration_Commands(benchmark::State& state) {
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        Registry registry;
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            registry.emplace<HealthSimple>(registry.create(), 100);
+        }
+        CommandBuffer& commands = registry.commands();
+        registry.each<HealthSimple>([&](auto, HealthSimple&) {
+            auto e = commands.create();
+            commands.emplace<Position>(e);
+            commands.emplace<Velocity>(e, 1.0f);
+        });
+        registry.flushCommands();
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Registry_SpawnDuringIteration_Commands)
+    ->Args({1'000})
+    ->Args({10'000})
+    ->Args({100'000});
+
+// -----------------------------------------------------------------------------
+// Storage backends: Motion update over the real components
+// -----------------------------------------------------------------------------
+static void populateMoving(Registry& registry, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        auto e = registry.create();
+        registry.emplace<GameEngine::Position>(e, float(i % 1920), float(i % 1080));
+        registry.emplace<GameEngine::Velocity>(e, 300.f, 10.f, -10.f);
+        registry.emplace<GameEngine::Acceleration>(e, 50.f, 50.f, true);
+        registry.emplace<GameEngine::Renderable>(e);
+        registry.emplace<GameEngine::Collider>(
+            e, vec2(0.f, 0.f), std::bitset<8>(0xFF), std::bitset<8>(0xFF),
+            vec2(32.f, 32.f));
+    }
+}
+
+static void BM_Storage_Motion_SparseSet(benchmark::State& state) {
+    Registry registry(StorageMode::SparseSet);
+    populateMoving(registry, static_cast<std::size_t>(state.range(0)));
+    GameEngine::Motion motion;
+
+    for (auto _ : state) {
+        motion.onUpdate(registry, 0.016f);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Storage_Motion_SparseSet)
+    ->Args({10'000})
+    ->Args({100'000});
+
+static void BM_Storage_Motion_Archetype(benchmark::State& state) {
+    Registry registry(StorageMode::Archetype);
+    populateMoving(registry, static_cast<std::size_t>(state.range(0)));
+    GameEngine::Motion motion;
+
+    for (auto _ : state) {
+        motion.onUpdate(registry, 0.016f);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Storage_Motion_Archetype)
+    ->Args({10'000})
+    ->Args({100'000});
+
+// -----------------------------------------------------------------------------
+// Motion system
+// -----------------------------------------------------------------------------
+static void BM_Motion_System(benchmark::State& state) {
+    Registry registry;
+    populateMoving(registry, static_cast<std::size_t>(state.range(0)));
+    GameEngine::Motion motion;
+
+    for (auto _ : state) {
+        motion.onUpdate(registry, 0.016f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Motion_System)
+    ->Args({1'000})
+    ->Args({10'000})
+    ->Args({100'000});
+
+// Motion system on a 50k-entity scene, by number of job system workers
+static void BM_Motion_Parallel(benchmark::State& state) {
+    Registry registry;
+    registry.setWorkerCount(static_cast<std::size_t>(state.range(0)));
+    populateMoving(registry, static_cast<std::size_t>(state.range(1)));
+    GameEngine::Motion motion;
+
+    for (auto _ : state) {
+        motion.onUpdate(registry, 0.016f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_Motion_Parallel)
+    ->ArgsProduct({{0, 1, 3, 7, 15}, {50'000}})
+    ->UseRealTime();
+
+// -----------------------------------------------------------------------------
+// Storage backends: add/remove churn (archetype moves vs pool inserts)
+// -----------------------------------------------------------------------------
+static void BM_Storage_AddRemove(benchmark::State& state) {
+    const auto mode = static_cast<StorageMode>(state.range(0));
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(1));
+    Registry registry(mode);
+    populateMoving(registry, COUNT);
+
+    for (auto _ : state) {
+        for (EntityManager::Entity e = 0; e < COUNT; ++e) {
+            registry.emplace<GameEngine::Damage>(e, 10);
+        }
+        for (EntityManager::Entity e = 0; e < COUNT; ++e) {
+            registry.remove<GameEngine::Damage>(e);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Storage_AddRemove)
+    ->Args({static_cast<int>(StorageMode::SparseSet), 10'000})
+    ->Args({static_cast<int>(StorageMode::Archetype), 10'000});
+
+// -----------------------------------------------------------------------------
+// Scheduler: two independent systems, sequential vs one worker thread
+// -----------------------------------------------------------------------------
+class DriftSystem : public System<DriftSystem> {
+public:
+    DriftSystem() {
+        requireComponents<Position, Velocity>();
+        writeComponents<Position>();
+    }
+
+    void onUpdate(Registry& registry, float dt) {
+        registry.each<Position, Velocity>([dt](auto, Position& pos, Velocity& vel) {
+            pos.x += vel.vx * dt;
+            pos.y += vel.vy * dt;
+        });
+    }
+};
+
+static void BM_Scheduler_Update(benchmark::State& state) {
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(1));
+    Registry registry;
+    registry.setWorkerCount(static_cast<std::size_t>(state.range(0)));
+    populateMoving(registry, COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        auto e = registry.create();
+        registry.emplace<Position>(e);
+        registry.emplace<Velocity>(e, 1.f, 1.f);
+    }
+    registry.addSystem<GameEngine::Motion>(0);
+    registry.addSystem<DriftSystem>(1);
+    const float dt = registry.getClock().getFixedDeltaTime();
+
+    double parallelism = 0.0;
+    for (auto _ : state) {
+        registry.update(dt);
+        parallelism += registry.getTimings().parallelism();
+        benchmark::ClobberMemory();
+    }
+    state.counters["parallelism"] = parallelism / double(state.iterations());
+    state.SetItemsProcessed(state.iterations() * state.range(1) * 2);
+}
+BENCHMARK(BM_Scheduler_Update)
+    ->ArgsProduct({{0, 1}, {10'000, 100'000}});
+
+// -----------------------------------------------------------------------------
+// Coût du profiler : update() sans (0) puis avec (1) profiler activé
+// -----------------------------------------------------------------------------
+static void BM_Scheduler_Update_Profiler(benchmark::State& state) {
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(1));
+    Registry registry;
+    registry.setWorkerCount(0);
+    populateMoving(registry, COUNT);
+    registry.addSystem<GameEngine::Motion>(0);
+    registry.addSystem<DriftSystem>(1);
+    if (state.range(0)) {
+        registry.profiler().enable();
+    }
+    const float dt = registry.getClock().getFixedDeltaTime();
+
+    for (auto _ : state) {
+        registry.update(dt);
+        benchmark::ClobberMemory();
+    }
+    if (state.range(0)) {
+        const ProfileStats step = registry.profiler().stepStats();
+        state.counters["step_p50_ms"] = step.p50;
+        state.counters["step_p99_ms"] = step.p99;
+        state.counters["entities"] = step.entities;
+    }
+}
+BENCHMARK(BM_Scheduler_Update_Profiler)
+    ->ArgsProduct({{0, 1}, {100, 10'000}});
+
 // -----------------------------------------------------------------------------
 // Fragmentation handling (Registry)
 // -----------------------------------------------------------------------------
@@ -247,6 +791,110 @@ BENCHMARK(BM_EntityManager_Fragmentation)
     ->Args({5'000'000})
     ->Args({10'000'000});
 
+// -----------------------------------------------------------------------------
+// SparseSet memory per pool (paged sparse index)
+// -----------------------------------------------------------------------------
+static void BM_SparseSet_MemoryPerPool(benchmark::State& state) {
+    const std::size_t MAX_ID = static_cast<std::size_t>(state.range(0));
+    const std::size_t STRIDE = static_cast<std::size_t>(state.range(1));
+    std::size_t bytes = 0;
+    std::size_t pages = 0;
+    for (auto _ : state) {
+        SparseSet<Registry::Entity, Position> pool;
+        for (std::size_t id = STRIDE - 1; id < MAX_ID; id += STRIDE) {
+            pool.emplace(static_cast<Registry::Entity>(id));
+        }
+        bytes = pool.memoryUsage();
+        pages = pool.pageCount();
+        benchmark::DoNotOptimize(bytes);
+        benchmark::ClobberMemory();
+    }
+    // Stride 1: every entity ID has the component.
+    // Stride 1000: a few components spread over the whole ID range.
+    state.counters["bytes_per_pool"] = static_cast<double>(bytes);
+    state.counters["sparse_pages"] = static_cast<double>(pages);
+    state.counters["paged_index_bytes"] = static_cast<double>(
+        pages * SparseSet<Registry::Entity, Position>::PAGE_BYTES);
+    state.counters["flat_index_bytes"] =
+        static_cast<double>(MAX_ID * sizeof(std::size_t));
+}
+BENCHMARK(BM_SparseSet_MemoryPerPool)
+    ->Args({10'000, 1})
+    ->Args({10'000, 1'000})
+    ->Args({100'000, 1})
+    ->Args({100'000, 1'000})
+    ->Args({1'000'000, 1})
+    ->Args({1'000'000, 1'000});
+
+// -----------------------------------------------------------------------------
+// SparseSet memory per pool - few components at the newest entity IDs
+// -----------------------------------------------------------------------------
+static void BM_SparseSet_MemoryPerPool_RecentIds(benchmark::State& state) {
+    const std::size_t MAX_ID = static_cast<std::size_t>(state.range(0));
+    const std::size_t HELD = 256;
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        SparseSet<Registry::Entity, Position> pool;
+        for (std::size_t id = MAX_ID - HELD; id < MAX_ID; ++id) {
+            pool.emplace(static_cast<Registry::Entity>(id));
+        }
+        bytes = pool.memoryUsage();
+        benchmark::DoNotOptimize(bytes);
+        benchmark::ClobberMemory();
+    }
+    state.counters["bytes_per_pool"] = static_cast<double>(bytes);
+    state.counters["flat_index_bytes"] =
+        static_cast<double>(MAX_ID * sizeof(std::size_t));
+}
+BENCHMARK(BM_SparseSet_MemoryPerPool_RecentIds)
+    ->Args({10'000})
+    ->Args({100'000})
+    ->Args({1'000'000});
+
+// -----------------------------------------------------------------------------
+// Allocations heap par tick en régime établi (Motion + Collision +
+// ApplyDamage), en séquentiel (0 worker), avec 3 workers puis avec le nombre
+// de workers par défaut (-1)
+// -----------------------------------------------------------------------------
+static void BM_Tick_HeapAllocations(benchmark::State& state) {
+    Registry registry;
+    if (state.range(1) >= 0) {
+        registry.setWorkerCount(static_cast<std::size_t>(state.range(1)));
+    }
+    populateMoving(registry, static_cast<std::size_t>(state.range(0)));
+    // Entités immobiles : la scène reste identique d'un tick à l'autre
+    registry.each<GameEngine::Velocity, GameEngine::Acceleration>(
+        [&registry](auto e, auto& vel, auto& acc) {
+            vel.x = vel.y = 0.f;
+            acc.x = acc.y = 0.f;
+            registry.emplace<GameEngine::Damage>(e, 0);
+            registry.emplace<GameEngine::Health>(e, 100.f, 100.f);
+        });
+    registry.addSystem<GameEngine::Motion>(0);
+    registry.addSystem<GameEngine::Collision>(1);
+    registry.addSystem<GameEngine::ApplyDamage>(2);
+
+    const float dt = registry.getClock().getFixedDeltaTime();
+    for (int i = 0; i < 3; ++i) {
+        registry.update(dt);  // premiers ticks : pools, groupes, arena
+    }
+
+    std::size_t allocations = 0;
+    for (auto _ : state) {
+        const std::size_t before = heapAllocations.load();
+        registry.update(dt);
+        allocations += heapAllocations.load() - before;
+    }
+    state.counters["allocs_per_tick"] = benchmark::Counter(
+        static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    state.counters["arena_bytes"] =
+        static_cast<double>(registry.frame().highWaterMark());
+    state.counters["workers"] =
+        static_cast<double>(registry.getWorkerCount());
+}
+BENCHMARK(BM_Tick_HeapAllocations)
+    ->ArgsProduct({{1'000, 10'000}, {0, 3, -1}});
+
 // -----------------------------------------------------------------------------
 // Collision system benchmark - distribution "normale"
 // -----------------------------------------------------------------------------
@@ -345,4 +993,161 @@ BENCHMARK(BM_CollisionSystem_Update_Dense)
     ->Args({5'000})
     ->Args({10'000});
 
+// -----------------------------------------------------------------------------
+// Collision sur une scène créée dans le désordre : pools non triés (0) vs
+// triés par cellule (1), Damage/Collider/Health suivant Position
+// -----------------------------------------------------------------------------
+static void BM_CollisionSystem_SpatialSort(benchmark::State& state) {
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(1));
+    Registry registry;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> x(0.f, 4000.f);
+    std::uniform_real_distribution<float> y(0.f, 4000.f);
+
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        auto e = registry.create();
+        registry.emplace<GameEngine::Position>(e, x(rng), y(rng));
+        registry.emplace<GameEngine::Collider>(
+            e, vec2(0.f, 0.f), std::bitset<8>(0xFF), std::bitset<8>(0xFF),
+            vec2(16.f, 16.f));
+        registry.emplace<GameEngine::Damage>(e, 0);
+        registry.emplace<GameEngine::Health>(e, 100.f, 100.f);
+        registry.emplace<GameEngine::Renderable>(e);
+    }
+
+    GameEngine::Collision collisionSystem;
+    collisionSystem.onUpdate(registry, 0.016f);
+    if (state.range(0) == 1) {
+        registry.sort<GameEngine::Position>(GameEngine::SpatialOrder{});
+        registry.sort<GameEngine::Damage, GameEngine::Position>();
+        registry.sort<GameEngine::Collider, GameEngine::Position>();
+        registry.sort<GameEngine::Health, GameEngine::Position>();
+    }
+
+    for (auto _ : state) {
+        collisionSystem.onUpdate(registry, 0.016f);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_CollisionSystem_SpatialSort)
+    ->ArgsProduct({{0, 1}, {10'000, 100'000}});
+
+// -----------------------------------------------------------------------------
+// Narrowphase seule : toutes les paires d'une cellule dense, scalaire (0) vs
+// SIMD (1), masques de couches compris
+// -----------------------------------------------------------------------------
+static void BM_Collision_Narrowphase(benchmark::State& state) {
+    const bool vectorized = state.range(0) != 0;
+    const std::size_t COUNT = static_cast<std::size_t>(state.range(1));
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coord(0.f, 256.f);
+    std::uniform_int_distribution<int> layer(0, 7);
+
+    std::vector<float> minX(COUNT), minY(COUNT), maxX(COUNT), maxY(COUNT);
+    std::vector<uint8_t> selector(COUNT), diff(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        minX[i] = coord(rng);
+        minY[i] = coord(rng);
+        maxX[i] = minX[i] + 16.f;
+        maxY[i] = minY[i] + 16.f;
+        selector[i] = static_cast<uint8_t>(1u << layer(rng));
+        diff[i] = static_cast<uint8_t>(~selector[i]);
+    }
+    const GameEngine::HitboxArrays boxes{
+        minX.data(), minY.data(), maxX.data(), maxY.data(),
+        selector.data(), diff.data(), nullptr, COUNT};
+    std::vector<uint32_t> hits(COUNT);
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::size_t k = 0; k < COUNT; ++k) {
+            const GameEngine::Hitbox box{
+                minX[k], minY[k], maxX[k], maxY[k], selector[k], diff[k]};
+            found += vectorized
+                         ? GameEngine::overlapHitboxes(box, boxes, k + 1, hits.data())
+                         : GameEngine::overlapHitboxesScalar(box, boxes, k + 1, hits.data());
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT * (COUNT - 1) / 2);
+}
+BENCHMARK(BM_Collision_Narrowphase)
+    ->ArgsProduct({{0, 1}, {64, 256, 1'024}});
+
+// -----------------------------------------------------------------------------
+// Mondes indépendants : 64 registries (Motion + Collision + ApplyDamage)
+// mis à jour en parallèle, chaque thread prenant une part des mondes. Chaque
+// monde tourne en séquentiel (0 worker) ou sur le JobSystem partagé par
+// défaut (-1, hardware_concurrency - 1 workers pour tous les mondes)
+// -----------------------------------------------------------------------------
+static void BM_Worlds_Concurrent(benchmark::State& state) {
+    constexpr std::size_t WORLDS = 64;
+    constexpr std::size_t ENTITIES = 1'000;
+    const std::size_t threadCount = static_cast<std::size_t>(state.range(0));
+
+    std::vector<std::unique_ptr<Registry>> worlds;
+    for (std::size_t w = 0; w < WORLDS; ++w) {
+        worlds.push_back(std::make_unique<Registry>());
+        if (state.range(1) >= 0) {
+            worlds.back()->setWorkerCount(
+                static_cast<std::size_t>(state.range(1)));
+        }
+        populateMoving(*worlds.back(), ENTITIES);
+        worlds.back()->addSystem<GameEngine::Motion>(0);
+        worlds.back()->addSystem<GameEngine::Collision>(1);
+        worlds.back()->addSystem<GameEngine::ApplyDamage>(2);
+    }
+    const float dt = worlds.front()->getClock().getFixedDeltaTime();
+
+    for (auto _ : state) {
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&, t] {
+                for (std::size_t w = t; w < WORLDS; w += threadCount) {
+                    worlds[w]->update(dt);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * WORLDS);
+    state.counters["workers_per_world"] =
+        static_cast<double>(worlds.front()->getWorkerCount());
+}
+BENCHMARK(BM_Worlds_Concurrent)
+    ->ArgsProduct({{1, 2, 4, 8}, {0, -1}})
+    ->UseRealTime();
+
+// -----------------------------------------------------------------------------
+// Animation : 10k sprites à 120 Hz, durée de frame en ms (1 = change à chaque
+// tick), un quart de sprites fixes (une seule frame)
+// -----------------------------------------------------------------------------
+static void BM_Animation_Update(benchmark::State& state) {
+    constexpr std::size_t COUNT = 10'000;
+    Registry registry;
+    registry.setWorkerCount(0);
+    auto& assets =
+        registry.resources().getOrEmplace<GameEngine::AssetRegistry>();
+    const auto animated = assets.animation(
+        {vec2(0, 0), vec2(32, 0), vec2(64, 0), vec2(96, 0)}, vec2(32, 32),
+        static_cast<int>(state.range(0)), true);
+    const auto still = assets.animation({vec2(0, 0)}, vec2(32, 32), 500, true);
+    const auto sheet = assets.sheet("assets/sprites/bench.png");
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        registry.emplace<GameEngine::Renderable>(
+            registry.create(), sheet, i % 4 == 0 ? still : animated);
+    }
+    registry.addSystem<GameEngine::Animation>();
+
+    const float dt = registry.getClock().getFixedDeltaTime();
+    for (auto _ : state) {
+        registry.update(dt);
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(BM_Animation_Update)->Arg(1)->Arg(50)->Arg(500)->Arg(1000);
+
 BENCHMARK_MAIN();
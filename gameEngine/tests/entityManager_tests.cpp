@@ -18,7 +18,9 @@ TEST(EntityManagerTest, CreateDestroySequence) {
     EXPECT_EQ(manager.alive(), 0);
 
     auto newEntity = manager.create();
-    EXPECT_TRUE(std::find(entities.begin(), entities.end(), newEntity) != entities.end());
+    EXPECT_TRUE(std::any_of(entities.begin(), entities.end(), [&](auto e) {
+        return EntityManager::indexOf(e) == EntityManager::indexOf(newEntity);
+    }));
 }
 
 TEST(EntityManagerTest, CreateIncrementsAliveCount) {
@@ -45,7 +47,9 @@ TEST(EntityManagerTest, ReusesDestroyedIds) {
     manager.destroy(e1);
     auto e2 = manager.create();
 
-    EXPECT_EQ(e1, e2);
+    EXPECT_EQ(EntityManager::indexOf(e1), EntityManager::indexOf(e2));
+    EXPECT_EQ(EntityManager::generationOf(e2), EntityManager::generationOf(e1) + 1);
+    EXPECT_NE(e1, e2);
 }
 
 TEST(EntityManagerTest, ClearResetsState) {
@@ -81,14 +85,16 @@ TEST(EntityManagerTest, CreateDestroySequenceChain) {
     EXPECT_EQ(manager.alive(), 0);
 
     auto newEntity = manager.create();
-    EXPECT_TRUE(std::find(entities.begin(), entities.end(), newEntity) != entities.end());
+    EXPECT_TRUE(std::any_of(entities.begin(), entities.end(), [&](auto e) {
+        return EntityManager::indexOf(e) == EntityManager::indexOf(newEntity);
+    }));
 }
 
 TEST(EntityManagerTest, InvalidEntityConstant) {
     EXPECT_EQ(EntityManager::INVALID_ENTITY, static_cast<uint32_t>(-1));
 }
 
-TEST(EntityManagerTest, ReusesIdsInLIFOOrder) {
+TEST(EntityManagerTest, ReusesIdsInFIFOOrder) {
     EntityManager manager;
     auto e1 = manager.create();
     auto e2 = manager.create();
@@ -98,10 +104,11 @@ TEST(EntityManagerTest, ReusesIdsInLIFOOrder) {
     manager.destroy(e2);
     
     auto e4 = manager.create();
-    EXPECT_EQ(e4, e2);
+    EXPECT_EQ(EntityManager::indexOf(e4), EntityManager::indexOf(e1));
     
     auto e5 = manager.create();
-    EXPECT_EQ(e5, e1);
+    EXPECT_EQ(EntityManager::indexOf(e5), EntityManager::indexOf(e2));
+    EXPECT_TRUE(manager.valid(e3));
 }
 
 TEST(EntityManagerTest, DoubleDestroyBehavior) {
@@ -112,7 +119,7 @@ TEST(EntityManagerTest, DoubleDestroyBehavior) {
     EXPECT_EQ(manager.alive(), 0);
 
     manager.destroy(e);
-    EXPECT_EQ(manager.alive(), static_cast<size_t>(-1));
+    EXPECT_EQ(manager.alive(), 0);
 }
 
 TEST(EntityManagerTest, HandlesLargeNumberOfEntities) {
@@ -129,6 +136,77 @@ TEST(EntityManagerTest, HandlesLargeNumberOfEntities) {
     EXPECT_EQ(entities.back(), COUNT - 1);
 }
 
+TEST(EntityManagerTest, SignatureTracksComponents) {
+    EntityManager manager;
+    auto e = manager.create();
+    EXPECT_TRUE(manager.signature(e).none());
+
+    manager.addComponent(e, 3);
+    manager.addComponent(e, 70);
+    EXPECT_TRUE(manager.signature(e).test(3));
+    EXPECT_TRUE(manager.signature(e).test(70));
+
+    manager.removeComponent(e, 3);
+    EXPECT_FALSE(manager.signature(e).test(3));
+    EXPECT_EQ(manager.signature(e).count(), 1);
+}
+
+TEST(EntityManagerTest, SignatureResetOnDestroy) {
+    EntityManager manager;
+    auto e = manager.create();
+    manager.addComponent(e, 5);
+
+    manager.destroy(e);
+    auto reused = manager.create();
+
+    EXPECT_EQ(EntityManager::indexOf(reused), EntityManager::indexOf(e));
+    EXPECT_TRUE(manager.signature(reused).none());
+    EXPECT_TRUE(manager.signature(9999).none());
+}
+
+TEST(EntityManagerTest, DestroyedHandlesAreNoLongerValid) {
+    EntityManager manager;
+    auto e = manager.create();
+    EXPECT_TRUE(manager.valid(e));
+
+    manager.destroy(e);
+    auto reused = manager.create();
+
+    EXPECT_FALSE(manager.valid(e));
+    EXPECT_TRUE(manager.valid(reused));
+    EXPECT_FALSE(manager.valid(EntityManager::INVALID_ENTITY));
+    EXPECT_FALSE(manager.valid(12345));
+}
+
+TEST(EntityManagerTest, StaleHandleSeesNoComponents) {
+    EntityManager manager;
+    auto e = manager.create();
+    manager.destroy(e);
+    auto reused = manager.create();
+    manager.addComponent(reused, 4);
+
+    EXPECT_TRUE(manager.signature(e).none());
+    EXPECT_TRUE(manager.signature(reused).test(4));
+
+    manager.destroy(e);
+    EXPECT_TRUE(manager.valid(reused));
+    EXPECT_EQ(manager.alive(), 1);
+}
+
+TEST(EntityManagerTest, GenerationWrapsAroundItsBits) {
+    EntityManager manager;
+    auto first = manager.create();
+    auto e = first;
+    for (int i = 0; i < 256; ++i) {
+        manager.destroy(e);
+        e = manager.create();
+    }
+
+    EXPECT_EQ(EntityManager::indexOf(e), EntityManager::indexOf(first));
+    EXPECT_EQ(EntityManager::generationOf(e), 0u);
+    EXPECT_NE(e, EntityManager::INVALID_ENTITY);
+}
+
 #include <chrono>
 
 TEST(EntityManagerPerformance, CreateDestroyBenchmark) {
@@ -168,6 +246,6 @@ TEST(EntityManagerPerformance, FragmentationTest) {
     }
 
     for (auto ne : newEntities) {
-        EXPECT_LT(ne, 10000u);
+        EXPECT_LT(EntityManager::indexOf(ne), 10000u);
     }
 }
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "../ecs/Events.hpp"
+#include <vector>
+
+namespace {
+struct Ping {
+    int id = 0;
+};
+
+std::vector<int> drain(const Events<Ping>& events, Events<Ping>::Cursor& cursor) {
+    std::vector<int> ids;
+    events.read(cursor, [&](const Ping& ping) { ids.push_back(ping.id); });
+    return ids;
+}
+}  // namespace
+
+TEST(EventsTest, ReadersGetEachEventOnce) {
+    Events<Ping> events;
+    Events<Ping>::Cursor cursor = events.end();
+    events.send({1});
+    events.emplace().id = 2;
+
+    EXPECT_EQ(drain(events, cursor), (std::vector<int>{1, 2}));
+    EXPECT_TRUE(drain(events, cursor).empty());
+
+    events.send({3});
+    EXPECT_EQ(drain(events, cursor), (std::vector<int>{3}));
+}
+
+TEST(EventsTest, EventsLiveUntilTheSecondUpdate) {
+    Events<Ping> events;
+    Events<Ping>::Cursor late = events.end();
+    events.send({1});
+    events.update();
+    events.send({2});
+
+    // A reader running before the producer still gets the previous step
+    EXPECT_EQ(drain(events, late), (std::vector<int>{1, 2}));
+    EXPECT_EQ(events.latest().size(), 1u);
+
+    events.update();
+    EXPECT_EQ(events.size(), 1u);
+    events.update();
+    EXPECT_EQ(events.size(), 0u);
+}
+
+TEST(EventsTest, DroppedEventsAreSkipped) {
+    Events<Ping> events;
+    Events<Ping>::Cursor cursor = events.end();
+    for (int step = 0; step < 3; ++step) {
+        events.update();
+        events.send({step});
+    }
+
+    EXPECT_EQ(events.begin(), 1u);
+    EXPECT_EQ(drain(events, cursor), (std::vector<int>{1, 2}));
+    EXPECT_EQ(cursor, events.end());
+}
+
+TEST(EventsTest, ClearKeepsCursorsValid) {
+    Events<Ping> events;
+    Events<Ping>::Cursor cursor = events.end();
+    events.send({1});
+    events.clear();
+    events.send({2});
+
+    EXPECT_EQ(drain(events, cursor), (std::vector<int>{2}));
+}
+
+TEST(EventsTest, UpdateKeepsTheCapacity) {
+    Events<Ping> events;
+    for (int i = 0; i < 100; ++i) {
+        events.send({i});
+    }
+    events.update();
+    for (int i = 0; i < 100; ++i) {
+        events.send({i});
+    }
+    const Ping* first = events.latest().data();
+    events.update();
+    events.update();
+    for (int i = 0; i < 100; ++i) {
+        events.send({i});
+    }
+
+    EXPECT_EQ(events.latest().data(), first);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "../ecs/FrameArena.hpp"
+#include <cstdint>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// ALLOCATION
+// ============================================================================
+
+TEST(FrameArenaTest, AllocationsComeFromTheBlock) {
+    FrameArena arena(1024);
+    void* a = arena.allocate(100, 8);
+    void* b = arena.allocate(100, 8);
+
+    EXPECT_NE(a, b);
+    EXPECT_GE(arena.used(), 200u);
+    EXPECT_EQ(arena.overflowCount(), 0u);
+}
+
+TEST(FrameArenaTest, RespectsAlignment) {
+    FrameArena arena(1024);
+    void* unaligned = arena.allocate(1, 1);
+    void* aligned = arena.allocate(32, 64);
+
+    EXPECT_GT(aligned, unaligned);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % 64, 0u);
+}
+
+TEST(FrameArenaTest, ResetReusesTheSameMemory) {
+    FrameArena arena(1024);
+    void* first = arena.allocate(64, 8);
+    arena.reset();
+
+    EXPECT_EQ(arena.used(), 0u);
+    EXPECT_EQ(arena.allocate(64, 8), first);
+}
+
+TEST(FrameArenaTest, OverflowGrowsTheBlockAtReset) {
+    FrameArena arena(256);
+    void* small = arena.allocate(200, 8);
+    void* large = arena.allocate(1000, 8);
+    EXPECT_NE(small, nullptr);
+    EXPECT_NE(large, nullptr);
+    EXPECT_EQ(arena.overflowCount(), 1u);
+
+    arena.reset();
+    EXPECT_GE(arena.capacity(), 1200u);
+    EXPECT_EQ(arena.overflowCount(), 0u);
+
+    small = arena.allocate(200, 8);
+    large = arena.allocate(1000, 8);
+    EXPECT_GE(static_cast<char*>(large), static_cast<char*>(small) + 200);
+    EXPECT_EQ(arena.overflowCount(), 0u);
+}
+
+TEST(FrameArenaTest, BacksPmrContainers) {
+    FrameArena arena(4096);
+    std::pmr::vector<int> values(&arena);
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i);
+    }
+
+    EXPECT_EQ(values[99], 99);
+    EXPECT_GE(arena.used(), 100 * sizeof(int));
+    EXPECT_EQ(arena.overflowCount(), 0u);
+}
+
+TEST(FrameArenaTest, HighWaterMarkSurvivesReset) {
+    FrameArena arena(1024);
+    void* first = arena.allocate(300, 8);
+    arena.reset();
+    EXPECT_EQ(arena.allocate(10, 8), first);
+
+    EXPECT_GE(arena.highWaterMark(), 300u);
+}
+
+// ============================================================================
+// CONCURRENCY
+// ============================================================================
+
+TEST(FrameArenaTest, ConcurrentAllocationsDoNotOverlap) {
+    constexpr int THREADS = 4;
+    constexpr int ALLOCATIONS = 500;
+    FrameArena arena(THREADS * ALLOCATIONS * 16);
+    std::vector<std::vector<int*>> owned(THREADS);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < ALLOCATIONS; ++i) {
+                int* value = static_cast<int*>(
+                    arena.allocate(sizeof(int), alignof(int)));
+                *value = t;
+                owned[t].push_back(value);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 0; t < THREADS; ++t) {
+        for (int* value : owned[t]) {
+            ASSERT_EQ(*value, t);
+        }
+    }
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include "../ecs/JobSystem.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// SUBMIT / WAIT
+// ============================================================================
+
+TEST(JobSystemTest, WaitRunsEveryJob) {
+    JobSystem jobs(3);
+    JobSystem::Counter counter;
+    std::atomic<int> done{0};
+    for (int i = 0; i < 100; ++i) {
+        jobs.submit(counter, [&done] { done++; });
+    }
+    jobs.wait(counter);
+
+    EXPECT_TRUE(counter.done());
+    EXPECT_EQ(done.load(), 100);
+}
+
+TEST(JobSystemTest, WithoutWorkersJobsRunOnTheCaller) {
+    JobSystem jobs(0);
+    JobSystem::Counter counter;
+    std::thread::id runner;
+    jobs.submit(counter, [&runner] { runner = std::this_thread::get_id(); });
+    jobs.wait(counter);
+
+    EXPECT_EQ(runner, std::this_thread::get_id());
+}
+
+TEST(JobSystemTest, WaitRethrowsTheJobException) {
+    JobSystem jobs(2);
+    JobSystem::Counter counter;
+    std::atomic<int> done{0};
+    jobs.submit(counter, [] { throw std::runtime_error("job failed"); });
+    for (int i = 0; i < 10; ++i) {
+        jobs.submit(counter, [&done] { done++; });
+    }
+
+    EXPECT_THROW(jobs.wait(counter), std::runtime_error);
+    EXPECT_EQ(done.load(), 10);
+}
+
+TEST(JobSystemTest, IdleWorkersStealQueuedJobs) {
+    JobSystem jobs(3);
+    JobSystem::Counter counter;
+    std::mutex mutex;
+    std::set<std::thread::id> runners;
+    for (int i = 0; i < 64; ++i) {
+        jobs.submit(counter, [&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            std::lock_guard<std::mutex> lock(mutex);
+            runners.insert(std::this_thread::get_id());
+        });
+    }
+    jobs.wait(counter);
+
+    EXPECT_GT(runners.size(), 1u);
+}
+
+TEST(JobSystemTest, NestedWaitsDoNotDeadlock) {
+    JobSystem jobs(2);
+    JobSystem::Counter outer;
+    std::atomic<int> done{0};
+    for (int i = 0; i < 8; ++i) {
+        jobs.submit(outer, [&] {
+            JobSystem::Counter inner;
+            for (int j = 0; j < 8; ++j) {
+                jobs.submit(inner, [&done] { done++; });
+            }
+            jobs.wait(inner);
+        });
+    }
+    jobs.wait(outer);
+
+    EXPECT_EQ(done.load(), 64);
+}
+
+// ============================================================================
+// PARALLEL FOR
+// ============================================================================
+
+TEST(JobSystemTest, ParallelForCoversTheRangeOnce) {
+    JobSystem jobs(3);
+    std::vector<std::atomic<int>> hits(10'000);
+    jobs.parallelFor(hits.size(), 128, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            hits[i]++;
+        }
+    });
+
+    for (const auto& hit : hits) {
+        ASSERT_EQ(hit.load(), 1);
+    }
+}
+
+TEST(JobSystemTest, ParallelForBelowGrainStaysOnTheCaller) {
+    JobSystem jobs(3);
+    std::vector<std::thread::id> runners;
+    jobs.parallelFor(100, 1024, [&](size_t begin, size_t end) {
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 100u);
+        runners.push_back(std::this_thread::get_id());
+    });
+
+    ASSERT_EQ(runners.size(), 1u);
+    EXPECT_EQ(runners[0], std::this_thread::get_id());
+}
+
+TEST(JobSystemTest, ParallelForOfNothingDoesNothing) {
+    JobSystem jobs(1);
+    bool called = false;
+    jobs.parallelFor(0, 16, [&](size_t, size_t) { called = true; });
+
+    EXPECT_FALSE(called);
+}
+
+TEST(JobSystemTest, ParallelForRethrowsAfterEveryRangeFinished) {
+    JobSystem jobs(2);
+    std::atomic<int> ranges{0};
+
+    EXPECT_THROW(
+        jobs.parallelFor(
+            64, 4,
+            [&](size_t begin, size_t) {
+                ranges++;
+                if (begin == 32) {
+                    throw std::runtime_error("range failed");
+                }
+            }),
+        std::runtime_error);
+    EXPECT_EQ(ranges.load(), 16);
+}
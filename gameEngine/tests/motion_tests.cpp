@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "../ecs/Registry.hpp"
+#include "../systems/motion/src/Motion.hpp"
+#include <vector>
+
+using namespace GameEngine;
+
+namespace {
+Registry::Entity spawnMoving(Registry& registry, float accelerationX) {
+    auto e = registry.create();
+    registry.emplace<Position>(e, 100.f, 100.f);
+    registry.emplace<Velocity>(e, 300.f);
+    registry.emplace<Acceleration>(e, accelerationX, 0.f, false);
+    registry.emplace<Renderable>(e);
+    registry.emplace<Collider>(
+        e, vec2(0.f, 0.f), std::bitset<8>(1), std::bitset<8>(1),
+        vec2(16.f, 16.f));
+    return e;
+}
+}  // namespace
+
+TEST(MotionTest, MovesAlongTheAcceleration) {
+    Registry registry;
+    auto e = spawnMoving(registry, 600.f);
+    registry.addSystem<Motion>();
+
+    registry.update(registry.getClock().getFixedDeltaTime());
+
+    EXPECT_GT(registry.get<Position>(e).pos.x, 100.f);
+    EXPECT_FLOAT_EQ(registry.get<Position>(e).pos.y, 100.f);
+}
+
+TEST(MotionTest, MovedEntitiesAreTrackedForDeltas) {
+    Registry registry;
+    registry.trackChanges<Position>();
+    registry.trackChanges<Velocity>();
+    auto moving = spawnMoving(registry, 600.f);
+    registry.addSystem<Motion>();
+    const float dt = registry.getClock().getFixedDeltaTime();
+    registry.update(dt);
+
+    const uint64_t sent = registry.getClock().frameCount;
+    registry.update(dt);
+
+    EXPECT_EQ(
+        registry.changed<Position>(sent),
+        (std::vector<Registry::Entity>{moving}));
+    EXPECT_EQ(
+        registry.changed<Velocity>(sent),
+        (std::vector<Registry::Entity>{moving}));
+    EXPECT_EQ(registry.changedAt<Position>(moving), sent + 1);
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "../ecs/Registry.hpp"
+#include <stdexcept>
+#include <vector>
+
+struct Spot {
+    float x = 0.0f;
+    float y = 0.0f;
+    Spot(float x = 0.0f, float y = 0.0f) : x(x), y(y) {}
+};
+
+struct Hull {
+    int hp = 1;
+    Hull(int hp = 1) : hp(hp) {}
+};
+
+struct Frames {
+    std::vector<int> ids;
+    Frames(std::vector<int> ids = {}) : ids(std::move(ids)) {}
+};
+
+struct Hostile {};
+
+static Prefab makeShip() {
+    Prefab ship;
+    ship.with<Spot>(1.0f, 2.0f)
+        .with<Hull>(3)
+        .with<Frames>(std::vector<int>{4, 5, 6})
+        .with<Hostile>();
+    return ship;
+}
+
+// ============================================================================
+// BLUEPRINT
+// ============================================================================
+
+TEST(PrefabTest, WithReplacesTheDefault) {
+    Prefab ship = makeShip();
+    ship.with<Hull>(7);
+
+    EXPECT_EQ(ship.size(), 4u);
+    EXPECT_TRUE(ship.has<Hull>());
+    EXPECT_FALSE(ship.has<int>());
+    EXPECT_EQ(ship.get<Hull>().hp, 7);
+    EXPECT_THROW(ship.get<int>(), std::out_of_range);
+}
+
+// ============================================================================
+// REGISTRY SPAWN
+// ============================================================================
+
+TEST(PrefabTest, SpawnCopiesEveryDefault) {
+    Registry registry;
+    Prefab ship = makeShip();
+
+    auto e = registry.spawn(ship);
+    ship.get<Frames>().ids.clear();
+
+    EXPECT_EQ(registry.signature(e), ship.signature());
+    EXPECT_FLOAT_EQ(registry.get<Spot>(e).y, 2.0f);
+    EXPECT_EQ(registry.get<Hull>(e).hp, 3);
+    EXPECT_EQ(registry.get<Frames>(e).ids, (std::vector<int>{4, 5, 6}));
+}
+
+TEST(PrefabTest, InitOverridesDefaultsBeforeSignalsFire) {
+    Registry registry;
+    Prefab ship = makeShip();
+    std::vector<int> constructed;
+    registry.onConstruct<Hull>().connect(
+        [&](Registry& registry, Registry::Entity e) {
+            constructed.push_back(registry.get<Hull>(e).hp);
+        });
+
+    auto e = registry.spawn(
+        ship, [&](Registry::Entity e) { registry.emplace<Hull>(e, 9); });
+
+    EXPECT_EQ(registry.get<Hull>(e).hp, 9);
+    EXPECT_EQ(constructed, (std::vector<int>{9}));
+}
+
+TEST(PrefabTest, BatchSpawnAppendsContiguously) {
+    Registry registry;
+    registry.spawn(makeShip());
+    Prefab ship = makeShip();
+
+    std::vector<Registry::Entity> spawned;
+    registry.spawn(ship, 100, [&](Registry::Entity e, size_t i) {
+        spawned.push_back(e);
+        registry.emplace<Spot>(e, float(i));
+    });
+
+    ASSERT_EQ(spawned.size(), 100u);
+    EXPECT_EQ(registry.count<Hull>(), 101u);
+    const auto& spots = registry.view<Spot>();
+    for (size_t i = 0; i < spawned.size(); ++i) {
+        EXPECT_EQ(spots.begin()[i + 1], spawned[i]);
+        EXPECT_FLOAT_EQ(registry.get<Spot>(spawned[i]).x, float(i));
+    }
+}
+
+TEST(PrefabTest, RepeatedSmallBatchesGrowGeometrically) {
+    Registry registry;
+    Prefab ship = makeShip();
+
+    size_t reallocations = 0;
+    size_t capacity = registry.capacity<Hull>();
+    for (int i = 0; i < 1000; ++i) {
+        registry.spawn(ship, 1, [](Registry::Entity, size_t) {});
+        if (registry.capacity<Hull>() != capacity) {
+            capacity = registry.capacity<Hull>();
+            reallocations++;
+        }
+    }
+
+    EXPECT_EQ(registry.count<Hull>(), 1000u);
+    EXPECT_LE(reallocations, 11u);
+}
+
+TEST(PrefabTest, ArchetypeStorageSpawnsToo) {
+    Registry registry(StorageMode::Archetype);
+
+    registry.spawn(makeShip(), 10, [](Registry::Entity, size_t) {});
+
+    int hp = 0;
+    registry.each<Hull, Hostile>([&](auto, Hull& hull, Hostile&) {
+        hp += hull.hp;
+    });
+    EXPECT_EQ(hp, 30);
+}
+
+// ============================================================================
+// COMMAND BUFFER SPAWN
+// ============================================================================
+
+TEST(PrefabTest, CommandsSpawnAtFlush) {
+    Registry registry;
+    Prefab ship = makeShip();
+    CommandBuffer& commands = registry.commands();
+
+    auto plain = commands.spawn(ship);
+    auto moved = commands.spawn(ship, [&](Registry::Entity e) {
+        commands.emplace<Spot>(e, 8.0f, 8.0f);
+    });
+    EXPECT_FALSE(registry.has<Hull>(plain));
+
+    registry.flushCommands();
+    EXPECT_EQ(registry.signature(plain), ship.signature());
+    EXPECT_FLOAT_EQ(registry.get<Spot>(plain).x, 1.0f);
+    EXPECT_FLOAT_EQ(registry.get<Spot>(moved).x, 8.0f);
+    EXPECT_EQ(registry.get<Frames>(moved).ids.size(), 3u);
+}
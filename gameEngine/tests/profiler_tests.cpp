@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "../ecs/Registry.hpp"
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Sample {
+    int value = 0;
+};
+
+class WalkingSystem : public System<WalkingSystem> {
+public:
+    WalkingSystem() { requireComponents<Sample>(); }
+    void onUpdate(Registry& registry, float) {
+        registry.each<Sample>([](auto, Sample& sample) { sample.value++; });
+        for (int i = 0; i < allocations; ++i) {
+            Profiler::countAllocation();
+        }
+    }
+    int allocations = 0;
+};
+
+class ParallelWalkingSystem : public System<ParallelWalkingSystem> {
+public:
+    ParallelWalkingSystem() { requireComponents<Sample>(); }
+    void onUpdate(Registry& registry, float) {
+        registry.parallelEach<Sample>(
+            [](auto, Sample& sample) { sample.value++; }, 64);
+    }
+};
+
+static void populate(Registry& registry, int count) {
+    for (int i = 0; i < count; ++i) {
+        registry.emplace<Sample>(registry.create());
+    }
+}
+
+// ============================================================================
+// RECORDING
+// ============================================================================
+
+TEST(ProfilerTest, DisabledByDefault) {
+    Registry registry;
+    auto& system = registry.addSystem<WalkingSystem>();
+    populate(registry, 10);
+    registry.update(registry.getClock().getFixedDeltaTime());
+
+    EXPECT_FALSE(registry.profiler().enabled());
+    EXPECT_EQ(registry.profiler().stepStats().samples, 0u);
+    EXPECT_EQ(
+        registry.profiler().systemStats(system.getSystemID()).samples, 0u);
+}
+
+TEST(ProfilerTest, RecordsEverySystemCallAndStep) {
+    Registry registry;
+    registry.setWorkerCount(0);
+    auto& system = registry.addSystem<WalkingSystem>();
+    system.allocations = 3;
+    populate(registry, 10);
+    registry.profiler().enable();
+
+    const float dt = registry.getClock().getFixedDeltaTime();
+    for (int i = 0; i < 5; ++i) {
+        registry.update(dt);
+    }
+
+    const ProfileStats stats =
+        registry.profiler().systemStats(system.getSystemID());
+    EXPECT_EQ(stats.samples, 5u);
+    EXPECT_DOUBLE_EQ(stats.entities, 10.0);
+    EXPECT_DOUBLE_EQ(stats.allocations, 3.0);
+    EXPECT_LE(stats.p50, stats.p99);
+    EXPECT_LE(stats.p99, stats.max);
+
+    const ProfileStats step = registry.profiler().stepStats();
+    EXPECT_EQ(step.samples, 5u);
+    EXPECT_GE(step.entities, 10.0);
+    EXPECT_GE(step.max, stats.max);
+}
+
+TEST(ProfilerTest, ParallelWorkCountsForTheSystem) {
+    Registry registry;
+    registry.setWorkerCount(2);
+    auto& system = registry.addSystem<ParallelWalkingSystem>();
+    populate(registry, 1000);
+    registry.profiler().enable();
+    registry.update(registry.getClock().getFixedDeltaTime());
+
+    EXPECT_DOUBLE_EQ(
+        registry.profiler().systemStats(system.getSystemID()).entities,
+        1000.0);
+    EXPECT_DOUBLE_EQ(registry.profiler().stepStats().entities, 1000.0);
+}
+
+TEST(ProfilerTest, DisableStopsRecording) {
+    Registry registry;
+    registry.addSystem<WalkingSystem>();
+    populate(registry, 1);
+    registry.profiler().enable();
+    const float dt = registry.getClock().getFixedDeltaTime();
+    registry.update(dt);
+    registry.profiler().disable();
+    registry.update(dt);
+
+    EXPECT_EQ(registry.profiler().stepStats().samples, 1u);
+}
+
+// ============================================================================
+// PERCENTILES
+// ============================================================================
+
+TEST(ProfilerTest, PercentilesCoverTheRollingWindow) {
+    WalkingSystem system;
+    std::vector<ISystem*> scheduled{&system};
+    Profiler profiler;
+    profiler.enable(10);
+
+    const auto origin = Profiler::Clock::now();
+    for (int ms = 1; ms <= 20; ++ms) {
+        const auto end = origin + std::chrono::milliseconds(ms);
+        profiler.beginStep(ms, 1, origin);
+        profiler.recordSystem(0, origin, end, {});
+        profiler.endStep(scheduled, end);
+    }
+
+    const ProfileStats stats = profiler.systemStats(system.getSystemID());
+    EXPECT_EQ(stats.samples, 10u);
+    EXPECT_NEAR(stats.p50, 15.0, 1e-6);
+    EXPECT_NEAR(stats.p99, 20.0, 1e-6);
+    EXPECT_NEAR(stats.max, 20.0, 1e-6);
+}
+
+// ============================================================================
+// CHROME TRACE
+// ============================================================================
+
+TEST(ProfilerTest, TraceCoversTheCapturedTicks) {
+    Registry registry;
+    registry.setWorkerCount(0);
+    registry.addSystem<WalkingSystem>();
+    populate(registry, 4);
+    registry.profiler().enable();
+    registry.profiler().captureTrace(registry.tick() + 1, registry.tick() + 2);
+
+    const float dt = registry.getClock().getFixedDeltaTime();
+    for (int i = 0; i < 4; ++i) {
+        registry.update(dt);
+    }
+    // One event for the system and one for the step, per captured tick
+    EXPECT_EQ(registry.profiler().traceEventCount(), 4u);
+
+    std::ostringstream json;
+    registry.profiler().writeChromeTrace(json);
+    const std::string trace = json.str();
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"cat\":\"step\""), std::string::npos);
+    EXPECT_NE(trace.find("\"entities\":4"), std::string::npos);
+    EXPECT_EQ(trace.find("e+"), std::string::npos);
+}
@@ -2,6 +2,11 @@
 #include "../ecs/Registry.hpp"
 #include <chrono>
 #include <algorithm>
+#include <thread>
+#include <atomic>
+#include <sstream>
+#include <tuple>
+#include <memory_resource>
 
 // test composants
 struct Position {
@@ -204,6 +209,45 @@ TEST(RegistryTest, ViewSingleComponent) {
     EXPECT_EQ(view.size(), 2);
 }
 
+TEST(RegistryTest, SignatureFollowsEmplaceAndRemove) {
+    Registry registry;
+    auto e = registry.create();
+    EXPECT_TRUE(registry.signature(e).none());
+
+    registry.emplace<Position>(e);
+    registry.emplace<Velocity>(e);
+    EXPECT_EQ(registry.signature(e).count(), 2);
+    EXPECT_TRUE(registry.signature(e).test(ComponentRegistry::typeID<Position>()));
+
+    registry.remove<Position>(e);
+    EXPECT_EQ(registry.signature(e).count(), 1);
+    EXPECT_FALSE(registry.has<Position>(e));
+    EXPECT_TRUE(registry.has<Velocity>(e));
+}
+
+TEST(RegistryTest, DestroyClearsSignatureAndPools) {
+    Registry registry;
+    auto e1 = registry.create();
+    auto e2 = registry.create();
+    registry.emplace<Position>(e1);
+    registry.emplace<Health>(e1);
+    registry.emplace<Position>(e2);
+
+    registry.destroy(e1);
+
+    EXPECT_TRUE(registry.signature(e1).none());
+    EXPECT_EQ(registry.count<Position>(), 1);
+    EXPECT_EQ(registry.count<Health>(), 0);
+    EXPECT_TRUE(registry.has<Position>(e2));
+}
+
+TEST(RegistryTest, HasOnUnknownEntityIsFalse) {
+    Registry registry;
+    registry.emplace<Position>(registry.create());
+
+    EXPECT_FALSE(registry.has<Position>(12345));
+}
+
 TEST(RegistryTest, EachSingleComponent) {
     Registry registry;
     auto e1 = registry.create();
@@ -258,6 +302,402 @@ TEST(RegistryTest, EachWithNoMatchingEntities) {
     EXPECT_EQ(count, 0);
 }
 
+TEST(RegistryTest, EachDoesNotCreateMissingPools) {
+    Registry registry;
+    auto e = registry.create();
+    registry.emplace<Position>(e);
+
+    int count = 0;
+    registry.each<Position, Renderable>([&count](auto, Position&, Renderable&) {
+        count++;
+    });
+
+    EXPECT_EQ(count, 0);
+    EXPECT_EQ(registry.count<Renderable>(), 0);
+}
+
+TEST(RegistryTest, GroupCollectsExistingEntities) {
+    Registry registry;
+    auto e1 = registry.create();
+    auto e2 = registry.create();
+    auto e3 = registry.create();
+
+    registry.emplace<Position>(e1, 1.0f);
+    registry.emplace<Velocity>(e1, 2.0f);
+    registry.emplace<Position>(e2);
+    registry.emplace<Position>(e3, 3.0f);
+    registry.emplace<Velocity>(e3, 4.0f);
+
+    auto& group = registry.group<Velocity>(observe<Position>);
+    EXPECT_EQ(group.size(), 2);
+    EXPECT_TRUE(group.contains(e1));
+    EXPECT_FALSE(group.contains(e2));
+    EXPECT_TRUE(group.contains(e3));
+
+    float sum = 0.0f;
+    group.each([&sum](auto, Velocity& vel, Position& pos) {
+        sum += vel.vx + pos.x;
+    });
+    EXPECT_FLOAT_EQ(sum, 10.0f);
+}
+
+TEST(RegistryTest, GroupTracksEmplaceRemoveAndDestroy) {
+    Registry registry;
+    auto& group = registry.group<Position, Velocity>();
+
+    auto e1 = registry.create();
+    auto e2 = registry.create();
+    registry.emplace<Position>(e1);
+    EXPECT_EQ(group.size(), 0);
+
+    registry.emplace<Velocity>(e1);
+    registry.emplace<Velocity>(e2);
+    registry.emplace<Position>(e2);
+    EXPECT_EQ(group.size(), 2);
+
+    registry.remove<Velocity>(e1);
+    EXPECT_EQ(group.size(), 1);
+    EXPECT_FALSE(group.contains(e1));
+
+    registry.destroy(e2);
+    EXPECT_TRUE(group.empty());
+}
+
+TEST(RegistryTest, GroupKeepsComponentsPacked) {
+    Registry registry;
+    auto& group = registry.group<Velocity>(observe<Position>);
+
+    std::vector<Registry::Entity> entities;
+    for (int i = 0; i < 10; ++i) {
+        auto e = registry.create();
+        entities.push_back(e);
+        registry.emplace<Velocity>(e, static_cast<float>(i));
+        if (i % 2 == 0) {
+            registry.emplace<Position>(e);
+        }
+    }
+
+    // Members sit at the front of the owned pool, components follow them
+    auto& velocities = registry.view<Velocity>();
+    for (size_t i = 0; i < group.size(); ++i) {
+        EXPECT_TRUE(group.contains(velocities.begin()[i]));
+    }
+    for (auto e : entities) {
+        const auto& vel = registry.get<Velocity>(e);
+        EXPECT_FLOAT_EQ(vel.vx, static_cast<float>(e - entities.front()));
+    }
+}
+
+TEST(RegistryTest, GroupAllowsDestroyDuringIteration) {
+    Registry registry;
+    auto& group = registry.group<Health>();
+
+    for (int i = 0; i < 8; ++i) {
+        registry.emplace<Health>(registry.create(), i % 2 == 0 ? 0 : 100);
+    }
+
+    int visited = 0;
+    group.each([&](auto e, Health& health) {
+        visited++;
+        if (health.hp == 0) {
+            registry.destroy(e);
+        }
+    });
+
+    EXPECT_EQ(visited, 8);
+    EXPECT_EQ(group.size(), 4);
+}
+
+TEST(RegistryTest, GroupIsReturnedOnSecondRequest) {
+    Registry registry;
+    auto& first = registry.group<Velocity>(observe<Position>);
+    auto& second = registry.group<Velocity>(observe<Position>);
+
+    EXPECT_EQ(&first, &second);
+}
+
+struct Marked {};
+
+TEST(RegistryTest, TagComponentsFilterEach) {
+    Registry registry;
+    std::vector<Registry::Entity> tagged;
+    for (int i = 0; i < 10; ++i) {
+        auto e = registry.create();
+        registry.emplace<Position>(e, float(i));
+        if (i % 3 == 0) {
+            registry.emplace<Marked>(e);
+            tagged.push_back(e);
+        }
+    }
+
+    std::vector<Registry::Entity> visited;
+    registry.each<Position, Marked>(
+        [&](auto e, Position&, Marked&) { visited.push_back(e); });
+    std::sort(visited.begin(), visited.end());
+
+    EXPECT_EQ(visited, tagged);
+    EXPECT_EQ(registry.count<Marked>(), tagged.size());
+    EXPECT_TRUE(registry.has<Marked>(tagged[1]));
+    registry.remove<Marked>(tagged[1]);
+    EXPECT_FALSE(registry.has<Marked>(tagged[1]));
+}
+
+TEST(RegistryTest, GroupsCanOwnAndObserveTags) {
+    Registry registry;
+    for (int i = 0; i < 6; ++i) {
+        auto e = registry.create();
+        registry.emplace<Position>(e, float(i));
+        registry.emplace<Velocity>(e);
+        if (i % 2 == 0) {
+            registry.emplace<Marked>(e);
+        }
+    }
+
+    float observedSum = 0.0f;
+    registry.group<Position>(observe<Marked>)
+        .each([&](auto, Position& pos, Marked&) { observedSum += pos.x; });
+    EXPECT_FLOAT_EQ(observedSum, 0.0f + 2.0f + 4.0f);
+
+    auto& owning = registry.group<Marked, Velocity>();
+    EXPECT_EQ(owning.size(), 3u);
+}
+
+TEST(RegistryTest, GroupOwnershipConflictThrows) {
+    Registry registry;
+    registry.group<Velocity>(observe<Position>);
+
+    EXPECT_THROW(registry.group<Velocity>(), std::logic_error);
+}
+
+// --- Sorting tests ---
+
+TEST(RegistrySortTest, SortOrdersTheDenseArray) {
+    Registry registry;
+    std::vector<std::pair<Registry::Entity, float>> created;
+    for (float x : {5.0f, 1.0f, 4.0f, 2.0f, 3.0f}) {
+        created.emplace_back(registry.create(), x);
+        registry.emplace<Position>(created.back().first, x);
+    }
+
+    registry.sort<Position>(
+        [](const Position& a, const Position& b) { return a.x < b.x; });
+
+    std::vector<float> walked;
+    registry.each<Position>(
+        [&](auto, Position& pos) { walked.push_back(pos.x); });
+    EXPECT_EQ(walked, (std::vector<float>{1, 2, 3, 4, 5}));
+
+    for (auto [e, x] : created) {
+        EXPECT_FLOAT_EQ(registry.get<Position>(e).x, x);
+    }
+}
+
+TEST(RegistrySortTest, CoOrderPutsSharedEntitiesFirstInTheSameOrder) {
+    Registry registry;
+    std::vector<Registry::Entity> entities;
+    for (int i = 0; i < 8; ++i) {
+        auto e = registry.create();
+        entities.push_back(e);
+        registry.emplace<Velocity>(e, float(i));
+    }
+    for (int i = 7; i >= 0; i -= 2) {
+        registry.emplace<Position>(entities[i], float(i));
+    }
+
+    registry.sort<Velocity, Position>();
+
+    auto& positions = registry.view<Position>();
+    auto& velocities = registry.view<Velocity>();
+    for (size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_EQ(velocities.begin()[i], positions.begin()[i]);
+    }
+    for (auto e : entities) {
+        EXPECT_FLOAT_EQ(registry.get<Velocity>(e).vx, float(e - entities[0]));
+    }
+}
+
+TEST(RegistrySortTest, GroupMembersStayPackedAndMoveTogether) {
+    Registry registry;
+    auto& group = registry.group<Velocity, Health>(observe<Position>);
+    for (int i = 0; i < 10; ++i) {
+        auto e = registry.create();
+        registry.emplace<Velocity>(e, float(10 - i));
+        registry.emplace<Health>(e, i);
+        if (i % 3 != 0) {
+            registry.emplace<Position>(e);
+        }
+    }
+
+    registry.sort<Velocity>(
+        [](const Velocity& a, const Velocity& b) { return a.vx < b.vx; });
+
+    auto& velocities = registry.view<Velocity>();
+    auto& healths = registry.view<Health>();
+    float previous = 0.0f;
+    for (size_t i = 0; i < group.size(); ++i) {
+        const auto e = velocities.begin()[i];
+        EXPECT_TRUE(group.contains(e));
+        EXPECT_EQ(healths.begin()[i], e);
+        EXPECT_GT(registry.get<Velocity>(e).vx, previous);
+        EXPECT_FLOAT_EQ(
+            registry.get<Velocity>(e).vx,
+            float(10 - registry.get<Health>(e).hp));
+        previous = registry.get<Velocity>(e).vx;
+    }
+}
+
+TEST(RegistrySortTest, IncrementalSortConvergesAndCoOrdersFollowers) {
+    Registry registry;
+    for (int i = 0; i < 500; ++i) {
+        auto e = registry.create();
+        registry.emplace<Position>(e, float((i * 7919) % 500));
+        if (i % 2 == 0) {
+            registry.emplace<Velocity>(e);
+        }
+    }
+
+    registry.sortIncrementally<Position, Velocity>(
+        [](const Position& a, const Position& b) { return a.x < b.x; },
+        std::chrono::microseconds(50));
+    for (int step = 0; step < 200; ++step) {
+        registry.update(registry.getClock().getFixedDeltaTime());
+    }
+
+    const auto& positions = registry.view<Position>();
+    EXPECT_TRUE(std::is_sorted(
+        positions.components().begin(), positions.components().end(),
+        [](const Position& a, const Position& b) { return a.x < b.x; }));
+    std::vector<Registry::Entity> shared;
+    for (auto e : positions) {
+        if (registry.has<Velocity>(e)) {
+            shared.push_back(e);
+        }
+    }
+    const auto& velocities = registry.view<Velocity>();
+    EXPECT_TRUE(std::equal(shared.begin(), shared.end(), velocities.begin()));
+
+    registry.stopSorting<Position>();
+    registry.get<Position>(positions.begin()[0]).x = 1000.0f;
+    registry.update(registry.getClock().getFixedDeltaTime());
+    EXPECT_FLOAT_EQ(positions.components().front().x, 1000.0f);
+}
+
+TEST(RegistrySortTest, ArchetypeStorageIsRejected) {
+    Registry registry(StorageMode::Archetype);
+
+    EXPECT_THROW(
+        registry.sort<Position>(
+            [](const Position& a, const Position& b) { return a.x < b.x; }),
+        std::logic_error);
+}
+
+// --- Query tests ---
+
+TEST(RegistryQueryTest, ExcludedComponentsFilterOut) {
+    Registry registry;
+    std::vector<Registry::Entity> expected;
+    for (int i = 0; i < 12; ++i) {
+        auto e = registry.create();
+        registry.emplace<Health>(e, i);
+        if (i % 3 == 0) {
+            registry.emplace<Velocity>(e);
+        } else if (i % 3 == 1) {
+            registry.emplace<Marked>(e);
+        } else {
+            expected.push_back(e);
+        }
+    }
+
+    std::vector<Registry::Entity> visited;
+    registry.each<Health>(
+        exclude<Velocity, Marked>,
+        [&](auto e, Health&) { visited.push_back(e); });
+    std::sort(visited.begin(), visited.end());
+
+    EXPECT_EQ(visited, expected);
+}
+
+TEST(RegistryQueryTest, OptionalComponentsArePointers) {
+    Registry registry;
+    auto withVelocity = registry.create();
+    auto without = registry.create();
+    registry.emplace<Position>(withVelocity, 1.0f);
+    registry.emplace<Velocity>(withVelocity, 2.0f);
+    registry.emplace<Position>(without, 3.0f);
+
+    float sum = 0.0f;
+    int missing = 0;
+    registry.each<Position>(
+        optional<Velocity>, [&](auto, Position& pos, Velocity* vel) {
+            sum += pos.x;
+            if (vel) {
+                sum += vel->vx;
+                vel->vx = 10.0f;
+            } else {
+                missing++;
+            }
+        });
+
+    EXPECT_FLOAT_EQ(sum, 6.0f);
+    EXPECT_EQ(missing, 1);
+    EXPECT_FLOAT_EQ(registry.get<Velocity>(withVelocity).vx, 10.0f);
+}
+
+TEST(RegistryQueryTest, ExcludeAndOptionalCombine) {
+    Registry registry;
+    for (int i = 0; i < 9; ++i) {
+        auto e = registry.create();
+        registry.emplace<Health>(e, i);
+        if (i % 3 == 0) {
+            registry.emplace<Velocity>(e);
+        }
+        if (i % 2 == 0) {
+            registry.emplace<Position>(e, float(i));
+        }
+    }
+
+    int visited = 0;
+    float positions = 0.0f;
+    registry.each<Health>(
+        exclude<Velocity>, optional<Position>,
+        [&](auto, Health& health, Position* pos) {
+            visited++;
+            EXPECT_EQ(pos != nullptr, health.hp % 2 == 0);
+            positions += pos ? pos->x : 0.0f;
+        });
+
+    EXPECT_EQ(visited, 6);
+    EXPECT_FLOAT_EQ(positions, 2.0f + 4.0f + 8.0f);
+}
+
+TEST(RegistryQueryTest, ArchetypeStorageMatchesSparseSet) {
+    for (StorageMode mode : {StorageMode::SparseSet, StorageMode::Archetype}) {
+        Registry registry(mode);
+        for (int i = 0; i < 10; ++i) {
+            auto e = registry.create();
+            registry.emplace<Health>(e, i);
+            if (i % 2 == 0) {
+                registry.emplace<Velocity>(e, float(i));
+            }
+            if (i % 5 == 0) {
+                registry.emplace<Renderable>(e);
+            }
+        }
+
+        int hp = 0;
+        float velocities = 0.0f;
+        registry.each<Health>(
+            exclude<Renderable>, optional<Velocity>,
+            [&](auto, Health& health, Velocity* vel) {
+                hp += health.hp;
+                velocities += vel ? vel->vx : 0.0f;
+            });
+
+        EXPECT_EQ(hp, 45 - 5);
+        EXPECT_FLOAT_EQ(velocities, 2.0f + 4.0f + 6.0f + 8.0f);
+    }
+}
+
 TEST(RegistryTest, AddSystem) {
     Registry registry;
     auto& system = registry.addSystem<MovementSystem>();
@@ -389,11 +829,1138 @@ TEST(RegistryTest, EntityReuseAfterDestroy) {
     registry.destroy(e1);
     
     auto e2 = registry.create();
-    EXPECT_EQ(e1, e2);
+    EXPECT_EQ(EntityManager::indexOf(e1), EntityManager::indexOf(e2));
+    EXPECT_NE(e1, e2);
 
     EXPECT_FALSE(registry.has<Position>(e2));
 }
 
+TEST(RegistryTest, StaleHandleDoesNotReachTheReusedEntity) {
+    Registry registry;
+
+    auto stale = registry.create();
+    registry.emplace<Position>(stale, 1.f, 2.f);
+    registry.destroy(stale);
+
+    auto e = registry.create();
+    registry.emplace<Position>(e, 3.f, 4.f);
+    ASSERT_EQ(EntityManager::indexOf(stale), EntityManager::indexOf(e));
+
+    EXPECT_FALSE(registry.valid(stale));
+    EXPECT_FALSE(registry.has<Position>(stale));
+    registry.remove<Position>(stale);
+    registry.destroy(stale);
+
+    EXPECT_TRUE(registry.valid(e));
+    ASSERT_TRUE(registry.has<Position>(e));
+    EXPECT_FLOAT_EQ(registry.get<Position>(e).x, 3.f);
+    EXPECT_EQ(registry.view<Position>().size(), 1u);
+}
+
+TEST(RegistryTest, StaleEmplaceDoesNotReachTheReusedEntity) {
+    Registry registry;
+
+    auto stale = registry.create();
+    registry.destroy(stale);
+    auto e = registry.create();
+    ASSERT_EQ(EntityManager::indexOf(stale), EntityManager::indexOf(e));
+
+    EXPECT_THROW(registry.emplace<Position>(stale), std::logic_error);
+    EXPECT_FALSE(registry.has<Position>(e));
+    EXPECT_FALSE(registry.has<Position>(stale));
+
+    registry.emplace<Position>(e, 3.f, 4.f);
+    EXPECT_THROW(registry.emplace<Position>(stale, 5.f, 6.f), std::logic_error);
+    EXPECT_FLOAT_EQ(registry.get<Position>(e).x, 3.f);
+
+    std::vector<Registry::Entity> visited;
+    registry.each<Position>(
+        [&](Registry::Entity entity, Position&) { visited.push_back(entity); });
+    EXPECT_EQ(visited, std::vector<Registry::Entity>{e});
+}
+
+TEST(RegistryTest, DeferredCommandsSkipStaleHandles) {
+    Registry registry;
+
+    auto stale = registry.create();
+    registry.emplace<Position>(stale);
+    registry.commands().emplace<Velocity>(stale);
+    registry.commands().destroy(stale);
+    registry.destroy(stale);
+
+    auto e = registry.create();
+    registry.emplace<Position>(e);
+    registry.flushCommands();
+
+    EXPECT_TRUE(registry.valid(e));
+    EXPECT_TRUE(registry.has<Position>(e));
+    EXPECT_FALSE(registry.has<Velocity>(e));
+}
+
+// --- Command buffer tests ---
+
+class SpawnerSystem : public System<SpawnerSystem> {
+public:
+    void onUpdate(Registry& registry, float) {
+        CommandBuffer& commands = registry.commands();
+        auto e = commands.create();
+        commands.emplace<Position>(e, 1.0f, 2.0f, 3.0f);
+        commands.emplace<Velocity>(e);
+    }
+};
+
+class SpawnCounterSystem : public System<SpawnCounterSystem> {
+public:
+    size_t seen = 0;
+
+    void onUpdate(Registry& registry, float) {
+        seen = registry.count<Position>();
+    }
+};
+
+TEST(RegistryTest, CommandsAreDeferredUntilFlush) {
+    Registry registry;
+    auto existing = registry.create();
+    registry.emplace<Health>(existing);
+
+    CommandBuffer& commands = registry.commands();
+    auto e = commands.create();
+    commands.emplace<Position>(e, 4.0f);
+    commands.destroy(existing);
+
+    EXPECT_EQ(commands.size(), 2);
+    EXPECT_FALSE(registry.has<Position>(e));
+    EXPECT_TRUE(registry.has<Health>(existing));
+
+    registry.flushCommands();
+
+    EXPECT_TRUE(commands.empty());
+    EXPECT_TRUE(registry.has<Position>(e));
+    EXPECT_FLOAT_EQ(registry.get<Position>(e).x, 4.0f);
+    EXPECT_FALSE(registry.has<Health>(existing));
+}
+
+TEST(RegistryTest, CommandsDestroyIsDeduplicated) {
+    Registry registry;
+    auto e1 = registry.create();
+    auto e2 = registry.create();
+    registry.emplace<Health>(e1);
+    registry.emplace<Health>(e2);
+
+    CommandBuffer& commands = registry.commands();
+    commands.destroy(e1);
+    commands.destroy(e1);
+    registry.flushCommands();
+
+    EXPECT_EQ(registry.alive(), 1);
+    EXPECT_EQ(registry.count<Health>(), 1);
+    EXPECT_TRUE(registry.has<Health>(e2));
+}
+
+TEST(RegistryTest, CommandsRemovalsRunAfterEmplaces) {
+    Registry registry;
+    auto e = registry.create();
+    registry.emplace<Position>(e);
+
+    CommandBuffer& commands = registry.commands();
+    commands.remove<Position>(e);
+    commands.emplace<Velocity>(e, 5.0f);
+    registry.flushCommands();
+
+    EXPECT_FALSE(registry.has<Position>(e));
+    EXPECT_TRUE(registry.has<Velocity>(e));
+    EXPECT_FALSE(registry.getAvailableComponents().test(
+        ComponentRegistry::typeID<Position>()));
+}
+
+TEST(RegistryTest, CommandsFlushedAfterEachSystem) {
+    Registry registry;
+    registry.addSystem<SpawnerSystem>(0);
+    auto& counter = registry.addSystem<SpawnCounterSystem>(1);
+
+    registry.update(registry.getClock().getFixedDeltaTime());
+
+    EXPECT_EQ(counter.seen, 1);
+    EXPECT_EQ(registry.count<Velocity>(), 1);
+}
+
+TEST(RegistryTest, CommandsDestroyDuringEach) {
+    Registry registry;
+    for (int i = 0; i < 10; ++i) {
+        registry.emplace<Health>(registry.create(), i % 2 == 0 ? 0 : 100);
+    }
+
+    CommandBuffer& commands = registry.commands();
+    int visited = 0;
+    registry.each<Health>([&](auto e, Health& health) {
+        visited++;
+        if (health.hp == 0) {
+            commands.destroy(e);
+        }
+    });
+    registry.flushCommands();
+
+    EXPECT_EQ(visited, 10);
+    EXPECT_EQ(registry.count<Health>(), 5);
+}
+
+TEST(RegistryTest, CommandBuffersArePerThread) {
+    Registry registry;
+    const int THREADS = 4;
+    const int PER_THREAD = 100;
+
+    std::vector<CommandBuffer*> buffers(THREADS);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            CommandBuffer& commands = registry.commands();
+            buffers[t] = &commands;
+            for (int i = 0; i < PER_THREAD; ++i) {
+                commands.emplace<Position>(commands.create(), float(t));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    registry.flushCommands();
+
+    for (int t = 1; t < THREADS; ++t) {
+        EXPECT_NE(buffers[t], buffers[0]);
+    }
+    EXPECT_EQ(registry.alive(), THREADS * PER_THREAD);
+    EXPECT_EQ(registry.count<Position>(), THREADS * PER_THREAD);
+}
+
+// --- Scheduler tests ---
+
+class IntegrateSystem : public System<IntegrateSystem> {
+public:
+    IntegrateSystem() {
+        requireComponents<Position, Velocity>();
+        writeComponents<Position>();
+    }
+
+    void onUpdate(Registry& registry, float dt) {
+        registry.each<Position, Velocity>([dt](auto, Position& pos, Velocity& vel) {
+            pos.x += vel.vx * dt;
+            pos.y += vel.vy * dt;
+        });
+    }
+};
+
+class RegenSystem : public System<RegenSystem> {
+public:
+    RegenSystem() {
+        requireComponents<Health>();
+        writeComponents<Health>();
+    }
+
+    void onUpdate(Registry& registry, float) {
+        registry.each<Health>([](auto, Health& health) {
+            health.hp += 1;
+        });
+    }
+};
+
+class HeightReaderSystem : public System<HeightReaderSystem> {
+public:
+    float highest = 0.0f;
+
+    HeightReaderSystem() {
+        requireComponents<Position>();
+        readComponents<>();
+    }
+
+    void onUpdate(Registry& registry, float) {
+        highest = 0.0f;
+        registry.each<Position>([this](auto, Position& pos) {
+            highest = std::max(highest, pos.y);
+        });
+    }
+};
+
+class DeclaredSpawnerSystem : public System<DeclaredSpawnerSystem> {
+public:
+    DeclaredSpawnerSystem() {
+        writeComponents<Position, Velocity, Health>();
+        changeEntities();
+    }
+
+    void onUpdate(Registry& registry, float) {
+        CommandBuffer& commands = registry.commands();
+        auto e = commands.create();
+        commands.emplace<Position>(e, 0.0f, float(spawned));
+        commands.emplace<Velocity>(e, 1.0f, 2.0f);
+        commands.emplace<Health>(e, spawned++);
+    }
+
+    int spawned = 0;
+};
+
+class ReaperSystem : public System<ReaperSystem> {
+public:
+    ReaperSystem() {
+        requireComponents<Health>();
+        changeEntities();
+    }
+
+    void onUpdate(Registry& registry, float) {
+        CommandBuffer& commands = registry.commands();
+        registry.each<Health>([&commands](auto e, Health& health) {
+            if (health.hp % 7 == 0) {
+                commands.destroy(e);
+            }
+        });
+    }
+};
+
+/// Waits until `expected` systems are inside onUpdate() at the same time.
+class RendezvousSystem : public System<RendezvousSystem> {
+public:
+    RendezvousSystem(std::atomic<int>* arrived, int expected)
+        : arrived(arrived), expected(expected) {
+        readComponents<>();
+    }
+
+    void onUpdate(Registry&, float) {
+        arrived->fetch_add(1);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (arrived->load() < expected && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        met = arrived->load() >= expected;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    std::atomic<int>* arrived;
+    int expected;
+    bool met = false;
+};
+
+static std::vector<size_t> stagesOf(const Registry& registry) {
+    std::vector<size_t> stages;
+    for (const auto& timing : registry.getTimings().systems) {
+        stages.push_back(timing.stage);
+    }
+    return stages;
+}
+
+TEST(RegistrySchedulerTest, StagesFollowDeclaredAccess) {
+    Registry registry;
+    registry.setWorkerCount(2);
+    registry.addSystem<IntegrateSystem>(0);
+    registry.addSystem<RegenSystem>(1);
+    registry.addSystem<HeightReaderSystem>(2);
+    registry.addSystem<MovementSystem>(3);
+    registry.emplace<Position>(registry.create());
+
+    registry.update(registry.getClock().getFixedDeltaTime());
+
+    EXPECT_EQ(stagesOf(registry), (std::vector<size_t>{0, 0, 1, 2}));
+    EXPECT_EQ(registry.getTimings().stages, 3);
+}
+
+TEST(RegistrySchedulerTest, NoWorkersRunsOneSystemPerStage) {
+    Registry registry;
+    registry.setWorkerCount(0);
+    registry.addSystem<IntegrateSystem>(0);
+    registry.addSystem<RegenSystem>(1);
+    registry.addSystem<HeightReaderSystem>(2);
+
+    registry.update(registry.getClock().getFixedDeltaTime());
+
+    EXPECT_EQ(stagesOf(registry), (std::vector<size_t>{0, 1, 2}));
+}
+
+TEST(RegistrySchedulerTest, DefaultWorldsShareOneJobSystem) {
+    Registry first;
+    Registry second;
+    Registry custom;
+    custom.setWorkerCount(Scheduler::defaultWorkerCount() + 1);
+
+    EXPECT_EQ(&first.jobs(), &Scheduler::sharedJobs());
+    EXPECT_EQ(&second.jobs(), &Scheduler::sharedJobs());
+    EXPECT_NE(&custom.jobs(), &Scheduler::sharedJobs());
+    EXPECT_EQ(custom.jobs().size(), Scheduler::defaultWorkerCount() + 1);
+}
+
+TEST(RegistrySchedulerTest, StructuralSystemsAreSerialized) {
+    Registry registry;
+    registry.setWorkerCount(2);
+    registry.addSystem<DeclaredSpawnerSystem>(0);
+    registry.addSystem<ReaperSystem>(1);
+
+    registry.update(registry.getClock().getFixedDeltaTime());
+
+    EXPECT_EQ(stagesOf(registry), (std::vector<size_t>{0, 1}));
+}
+
+TEST(RegistrySchedulerTest, DisabledSystemsAreNotScheduled) {
+    Registry registry;
+    registry.setWorkerCount(2);
+    registry.addSystem<IntegrateSystem>(0);
+    registry.addSystem<MovementSystem>(1).enabled = false;
+    registry.addSystem<RegenSystem>(2);
+
+    registry.update(registry.getClock().getFixedDeltaTime());
+
+    EXPECT_EQ(stagesOf(registry), (std::vector<size_t>{0, 0}));
+}
+
+TEST(RegistrySchedulerTest, StageSystemsRunConcurrently) {
+    Registry registry;
+    registry.setWorkerCount(1);
+    std::atomic<int> arrived{0};
+    auto& first = registry.addSystem<RendezvousSystem>(0, &arrived, 2);
+    auto& second = registry.addSystem<RendezvousSystem>(1, &arrived, 2);
+
+    registry.update(registry.getClock().getFixedDeltaTime());
+
+    EXPECT_TRUE(first.met);
+    EXPECT_TRUE(second.met);
+    EXPECT_GT(registry.getTimings().parallelism(), 1.0);
+}
+
+TEST(RegistrySchedulerTest, ParallelUpdateMatchesSequentialUpdate) {
+    auto simulate = [](size_t workers) {
+        Registry registry;
+        registry.setWorkerCount(workers);
+        registry.addSystem<DeclaredSpawnerSystem>(0);
+        registry.addSystem<IntegrateSystem>(1);
+        registry.addSystem<RegenSystem>(2);
+        registry.addSystem<HeightReaderSystem>(3);
+        registry.addSystem<ReaperSystem>(4);
+
+        for (int i = 0; i < 50; ++i) {
+            registry.update(registry.getClock().getFixedDeltaTime());
+        }
+
+        std::vector<std::tuple<Registry::Entity, float, float, int>> state;
+        registry.each<Position, Health>([&](auto e, Position& pos, Health& health) {
+            state.emplace_back(e, pos.x, pos.y, health.hp);
+        });
+        std::sort(state.begin(), state.end());
+        return state;
+    };
+
+    auto sequential = simulate(0);
+    EXPECT_FALSE(sequential.empty());
+    EXPECT_EQ(simulate(3), sequential);
+}
+
+TEST(RegistrySchedulerTest, TimingsNameEverySystem) {
+    Registry registry;
+    registry.setWorkerCount(2);
+    auto& integrate = registry.addSystem<IntegrateSystem>(0);
+    auto& regen = registry.addSystem<RegenSystem>(1);
+
+    registry.update(registry.getClock().getFixedDeltaTime());
+
+    const TickTimings& timings = registry.getTimings();
+    ASSERT_EQ(timings.systems.size(), 2);
+    EXPECT_EQ(timings.systems[0].id, integrate.getSystemID());
+    EXPECT_EQ(timings.systems[0].name, integrate.getName());
+    EXPECT_EQ(timings.systems[1].id, regen.getSystemID());
+    EXPECT_GE(timings.systems[0].milliseconds, 0.0);
+    EXPECT_GE(timings.milliseconds, 0.0);
+
+    std::ostringstream report;
+    report << timings;
+    EXPECT_NE(report.str().find(integrate.getName()), std::string::npos);
+}
+
+TEST(RegistrySchedulerTest, SystemExceptionsReachTheCaller) {
+    class ThrowingSystem : public System<ThrowingSystem> {
+    public:
+        ThrowingSystem() {
+            readComponents<>();
+        }
+
+        void onUpdate(Registry&, float) {
+            throw std::runtime_error("system failed");
+        }
+    };
+
+    Registry registry;
+    registry.setWorkerCount(2);
+    registry.addSystem<ThrowingSystem>(0);
+    registry.addSystem<RegenSystem>(1);
+
+    EXPECT_THROW(
+        registry.update(registry.getClock().getFixedDeltaTime()),
+        std::runtime_error);
+}
+
+// --- parallelEach tests ---
+
+TEST(RegistryParallelEachTest, VisitsEveryMatchingEntityOnce) {
+    Registry registry;
+    registry.setWorkerCount(3);
+    for (int i = 0; i < 5000; ++i) {
+        auto e = registry.create();
+        registry.emplace<Position>(e, float(i));
+        if (i % 3 == 0) {
+            registry.emplace<Velocity>(e, 1.0f);
+        }
+    }
+
+    std::atomic<int> visited{0};
+    registry.parallelEach<Position, Velocity>(
+        [&](auto, Position& pos, Velocity& vel) {
+            pos.y += vel.vx;
+            visited++;
+        },
+        64);
+
+    EXPECT_EQ(visited.load(), 1667);
+    registry.each<Position>([&](auto e, Position& pos) {
+        EXPECT_FLOAT_EQ(pos.y, registry.has<Velocity>(e) ? 1.0f : 0.0f);
+    });
+}
+
+TEST(RegistryParallelEachTest, StructuralChangesGoThroughCommands) {
+    Registry registry;
+    registry.setWorkerCount(3);
+    for (int i = 0; i < 4000; ++i) {
+        registry.emplace<Health>(registry.create(), i % 2 == 0 ? 0 : 100);
+    }
+
+    registry.parallelEach<Health>(
+        [&registry](auto e, Health& health) {
+            if (health.hp == 0) {
+                registry.commands().destroy(e);
+            } else {
+                registry.commands().emplace<Tag>(e, "alive");
+            }
+        },
+        100);
+    registry.flushCommands();
+
+    EXPECT_EQ(registry.count<Health>(), 2000);
+    EXPECT_EQ(registry.count<Tag>(), 2000);
+}
+
+TEST(RegistryParallelEachTest, GroupParallelEachVisitsEveryMember) {
+    Registry registry;
+    registry.setWorkerCount(2);
+    for (int i = 0; i < 3000; ++i) {
+        auto e = registry.create();
+        registry.emplace<Velocity>(e, 2.0f);
+        if (i % 2 == 0) {
+            registry.emplace<Position>(e);
+        }
+    }
+
+    auto& group = registry.group<Velocity>(observe<Position>);
+    group.parallelEach(
+        [](auto, Velocity& vel, Position& pos) {
+            pos.x += vel.vx;
+        },
+        50);
+
+    float sum = 0.0f;
+    registry.each<Position>([&sum](auto, Position& pos) {
+        sum += pos.x;
+    });
+    EXPECT_FLOAT_EQ(sum, 3000.0f);
+}
+
+TEST(RegistryParallelEachTest, ArchetypeStorageIsSplitByChunk) {
+    Registry registry(StorageMode::Archetype);
+    registry.setWorkerCount(2);
+    for (int i = 0; i < 5000; ++i) {
+        auto e = registry.create();
+        registry.emplace<Position>(e, float(i));
+        registry.emplace<Velocity>(e, 1.0f);
+    }
+
+    std::atomic<int> visited{0};
+    registry.parallelEach<Position, Velocity>(
+        [&visited](auto, Position& pos, Velocity& vel) {
+            pos.x += vel.vx;
+            visited++;
+        });
+
+    EXPECT_EQ(visited.load(), 5000);
+    EXPECT_FLOAT_EQ(registry.get<Position>(0).x, 1.0f);
+}
+
+class ParallelIntegrateSystem : public System<ParallelIntegrateSystem> {
+public:
+    ParallelIntegrateSystem() {
+        requireComponents<Position, Velocity>();
+        writeComponents<Position>();
+    }
+
+    void onUpdate(Registry& registry, float dt) {
+        registry.parallelEach<Position, Velocity>(
+            [dt](auto, Position& pos, Velocity& vel) {
+                pos.x += vel.vx * dt;
+            },
+            32);
+    }
+};
+
+TEST(RegistryParallelEachTest, NestsInsideParallelStages) {
+    Registry registry;
+    registry.setWorkerCount(2);
+    registry.addSystem<ParallelIntegrateSystem>(0);
+    registry.addSystem<RegenSystem>(1);
+    for (int i = 0; i < 1000; ++i) {
+        auto e = registry.create();
+        registry.emplace<Position>(e);
+        registry.emplace<Velocity>(e, 1.0f);
+        registry.emplace<Health>(e, 0);
+    }
+
+    const float dt = registry.getClock().getFixedDeltaTime();
+    registry.update(dt);
+
+    EXPECT_EQ(registry.getTimings().stages, 1);
+    registry.each<Position, Health>([dt](auto, Position& pos, Health& health) {
+        EXPECT_FLOAT_EQ(pos.x, dt);
+        EXPECT_EQ(health.hp, 1);
+    });
+}
+
+// --- Frame arena and pool allocator tests ---
+
+class FrameUserSystem : public System<FrameUserSystem> {
+public:
+    void onUpdate(Registry& registry, float) {
+        usedAtStart.push_back(registry.frame().used());
+        std::pmr::vector<int> scratch(&registry.frame());
+        scratch.resize(1000, 1);
+    }
+    std::vector<size_t> usedAtStart;
+};
+
+TEST(RegistryFrameArenaTest, ResetBeforeEveryFixedStep) {
+    Registry registry;
+    auto& system = registry.addSystem<FrameUserSystem>(0);
+
+    const float dt = registry.getClock().getFixedDeltaTime();
+    for (int i = 0; i < 3; ++i) {
+        registry.update(dt);
+    }
+
+    ASSERT_EQ(system.usedAtStart.size(), 3u);
+    for (size_t used : system.usedAtStart) {
+        EXPECT_EQ(used, 0u);
+    }
+    EXPECT_GE(registry.frame().used(), 1000 * sizeof(int));
+}
+
+struct CountingResource : std::pmr::memory_resource {
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+    size_t allocations = 0;
+};
+
+TEST(RegistryFrameArenaTest, PoolsUseTheGivenResource) {
+    CountingResource resource;
+    {
+        Registry registry(StorageMode::SparseSet, &resource);
+        auto e = registry.create();
+        registry.emplace<Position>(e, 1.0f);
+
+        EXPECT_GT(resource.allocations, 0u);
+        EXPECT_EQ(registry.view<Position>().get_allocator().resource(), &resource);
+    }
+}
+
+// --- Change tracking tests ---
+
+TEST(RegistryChangeTrackingTest, UntrackedTypesReportNothing) {
+    Registry registry;
+    auto e = registry.create();
+    registry.emplace<Position>(e);
+    registry.get<Position>(e).x = 1.0f;
+
+    EXPECT_FALSE(registry.tracksChanges<Position>());
+    EXPECT_EQ(registry.changedAt<Position>(e), 0u);
+    EXPECT_TRUE(registry.changed<Position>(0).empty());
+}
+
+TEST(RegistryChangeTrackingTest, WritesAreStampedWithTheCurrentTick) {
+    Registry registry;
+    registry.trackChanges<Position>();
+    auto a = registry.create();
+    auto b = registry.create();
+    registry.emplace<Position>(a);
+    registry.emplace<Position>(b);
+    EXPECT_EQ(registry.changedAt<Position>(a), registry.tick());
+
+    const float dt = registry.getClock().getFixedDeltaTime();
+    registry.update(dt);
+    const uint64_t sent = registry.getClock().frameCount;
+    EXPECT_TRUE(registry.changed<Position>(sent).empty());
+
+    registry.patch<Position>(b, [](Position& pos) { pos.x = 5.0f; });
+    const Registry& reader = registry;
+    EXPECT_FLOAT_EQ(reader.get<Position>(a).x, 0.0f);
+
+    auto changed = registry.changed<Position>(sent);
+    ASSERT_EQ(changed.size(), 1u);
+    EXPECT_EQ(changed[0], b);
+    EXPECT_EQ(registry.changedAt<Position>(b), sent + 1);
+}
+
+TEST(RegistryChangeTrackingTest, MutableGetAndViewCountAsWrites) {
+    Registry registry;
+    registry.trackChanges<Position>();
+    auto a = registry.create();
+    auto b = registry.create();
+    registry.emplace<Position>(a);
+    registry.emplace<Position>(b);
+    registry.update(registry.getClock().getFixedDeltaTime());
+    const uint64_t sent = registry.getClock().frameCount;
+
+    registry.get<Position>(a);
+    EXPECT_EQ(registry.changed<Position>(sent).size(), 1u);
+
+    registry.view<Position>();
+    EXPECT_EQ(registry.changed<Position>(sent).size(), 2u);
+}
+
+class PatchingSystem : public System<PatchingSystem> {
+public:
+    PatchingSystem() { requireComponents<Health>(); }
+    void onUpdate(Registry& registry, float) {
+        if (target != EntityManager::INVALID_ENTITY) {
+            registry.patch<Health>(target, [](Health& health) { health.hp--; });
+            stamped = registry.tick();
+        }
+    }
+    Registry::Entity target = EntityManager::INVALID_ENTITY;
+    uint64_t stamped = 0;
+};
+
+TEST(RegistryChangeTrackingTest, SystemsStampTheRunningStep) {
+    Registry registry;
+    registry.trackChanges<Health>();
+    auto& system = registry.addSystem<PatchingSystem>(0);
+    auto e = registry.create();
+    registry.emplace<Health>(e, 10);
+    system.target = e;
+
+    const float dt = registry.getClock().getFixedDeltaTime();
+    registry.update(3 * dt + dt / 2);
+
+    const uint64_t frame = registry.getClock().frameCount;
+    EXPECT_EQ(system.stamped, frame);
+    EXPECT_EQ(registry.changedAt<Health>(e), frame);
+    EXPECT_EQ(registry.tick(), frame + 1);
+    EXPECT_EQ(registry.changed<Health>(frame - 1).size(), 1u);
+}
+
+class PositionReader : public System<PositionReader> {
+public:
+    PositionReader() {
+        requireComponents<Position>();
+        readComponents<Position>();
+    }
+    void onUpdate(Registry& registry, float) {
+        registry.each<Position>([this](auto, Position& pos) { sum += pos.x; });
+    }
+    float sum = 0.0f;
+};
+
+class HealthWriter : public System<HealthWriter> {
+public:
+    HealthWriter() {
+        requireComponents<Health>();
+        readComponents<Position>();
+        writeComponents<Health>();
+    }
+    void onUpdate(Registry& registry, float) {
+        registry.group<Health>(observe<Position>)
+            .parallelEach([](auto, Health& health, Position&) { health.hp--; });
+    }
+};
+
+TEST(RegistryChangeTrackingTest, IterationsStampWhatTheSystemWrites) {
+    Registry registry;
+    registry.setWorkerCount(2);
+    registry.trackChanges<Position>();
+    registry.trackChanges<Health>();
+    auto e = registry.create();
+    registry.emplace<Position>(e);
+    registry.emplace<Health>(e, 10);
+    registry.addSystem<PositionReader>(0);
+    registry.addSystem<HealthWriter>(1);
+    const float dt = registry.getClock().getFixedDeltaTime();
+    registry.update(dt);
+
+    const uint64_t sent = registry.getClock().frameCount;
+    registry.update(dt);
+
+    EXPECT_TRUE(registry.changed<Position>(sent).empty());
+    EXPECT_EQ(
+        registry.changed<Health>(sent), std::vector<Registry::Entity>{e});
+
+    registry.each<Position>([](auto, Position&) {});
+    EXPECT_EQ(
+        registry.changed<Position>(sent), std::vector<Registry::Entity>{e});
+}
+
+TEST(RegistryChangeTrackingTest, StampsFollowEntitiesWhenThePoolMoves) {
+    Registry registry;
+    registry.trackChanges<Position>();
+    std::vector<Registry::Entity> entities;
+    for (int i = 0; i < 4; ++i) {
+        entities.push_back(registry.create());
+        registry.emplace<Position>(entities.back());
+    }
+    registry.update(registry.getClock().getFixedDeltaTime());
+    const uint64_t sent = registry.getClock().frameCount;
+
+    registry.patch<Position>(entities[3], [](Position& pos) { pos.x = 1.0f; });
+    registry.destroy(entities[0]);
+    registry.emplace<Velocity>(entities[2]);
+    auto& group = registry.group<Position>(observe<Velocity>);
+    ASSERT_EQ(group.size(), 1u);
+
+    auto changed = registry.changed<Position>(sent);
+    ASSERT_EQ(changed.size(), 1u);
+    EXPECT_EQ(changed[0], entities[3]);
+}
+
+TEST(RegistryChangeTrackingTest, ArchetypeStorageIsRejected) {
+    Registry registry(StorageMode::Archetype);
+    EXPECT_THROW(registry.trackChanges<Position>(), std::logic_error);
+}
+
+// ============================================================================
+// SIGNALS
+// ============================================================================
+
+TEST(RegistrySignalTest, ConstructFiresOnceWhenAdded) {
+    Registry registry;
+    std::vector<Registry::Entity> constructed;
+    registry.onConstruct<Health>().connect(
+        [&](Registry& reg, Registry::Entity e) {
+            EXPECT_TRUE(reg.has<Health>(e));
+            constructed.push_back(e);
+        });
+
+    auto e = registry.create();
+    registry.emplace<Health>(e, 10);
+    registry.emplace<Health>(e, 20);
+    registry.emplace<Position>(e);
+
+    ASSERT_EQ(constructed.size(), 1u);
+    EXPECT_EQ(constructed[0], e);
+}
+
+TEST(RegistrySignalTest, UpdateFiresOnPatchOnly) {
+    Registry registry;
+    auto e = registry.create();
+    registry.emplace<Health>(e, 10);
+    int seenHp = -1;
+    registry.onUpdate<Health>().connect(
+        [&](Registry& reg, Registry::Entity entity) {
+            seenHp = static_cast<const Registry&>(reg).get<Health>(entity).hp;
+        });
+
+    registry.get<Health>(e).hp = 5;
+    EXPECT_EQ(seenHp, -1);
+
+    registry.patch<Health>(e, [](Health& health) { health.hp = 0; });
+    EXPECT_EQ(seenHp, 0);
+}
+
+TEST(RegistrySignalTest, DestroyFiresWhileTheComponentIsReadable) {
+    Registry registry;
+    auto a = registry.create();
+    auto b = registry.create();
+    registry.emplace<Health>(a, 1);
+    registry.emplace<Health>(b, 2);
+    registry.emplace<Position>(b);
+    std::vector<int> removedHp;
+    registry.onDestroy<Health>().connect(
+        [&](Registry& reg, Registry::Entity e) {
+            removedHp.push_back(
+                static_cast<const Registry&>(reg).get<Health>(e).hp);
+        });
+
+    registry.remove<Health>(a);
+    registry.remove<Health>(a);
+    registry.destroy(b);
+    registry.destroy(b);
+
+    ASSERT_EQ(removedHp.size(), 2u);
+    EXPECT_EQ(removedHp[0], 1);
+    EXPECT_EQ(removedHp[1], 2);
+}
+
+TEST(RegistrySignalTest, DisconnectedListenersAreNotCalled) {
+    Registry registry;
+    int calls = 0;
+    auto connection = registry.onConstruct<Health>().connect(
+        [&](Registry&, Registry::Entity) { calls++; });
+    registry.emplace<Health>(registry.create());
+    registry.onConstruct<Health>().disconnect(connection);
+    registry.emplace<Health>(registry.create());
+
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(registry.onConstruct<Health>().empty());
+}
+
+TEST(RegistrySignalTest, DeferredChangesPublishAtFlush) {
+    Registry registry;
+    int constructed = 0;
+    int destroyed = 0;
+    registry.onConstruct<Health>().connect(
+        [&](Registry&, Registry::Entity) { constructed++; });
+    registry.onDestroy<Health>().connect(
+        [&](Registry&, Registry::Entity) { destroyed++; });
+
+    auto doomed = registry.create();
+    registry.emplace<Health>(doomed);
+    auto& commands = registry.commands();
+    auto spawned = commands.create();
+    commands.emplace<Health>(spawned, 3);
+    commands.destroy(doomed);
+    EXPECT_EQ(constructed, 1);
+    EXPECT_EQ(destroyed, 0);
+
+    registry.flushCommands();
+    EXPECT_EQ(constructed, 2);
+    EXPECT_EQ(destroyed, 1);
+}
+
+TEST(RegistrySignalTest, ListenersRecordCommandsDuringFlush) {
+    Registry registry;
+    auto marker = registry.create();
+    Registry::Entity child = 0;
+    registry.onConstruct<Health>().connect(
+        [&](Registry& r, Registry::Entity e) {
+            if (r.get<Health>(e).hp != 1)
+                return;
+            auto& commands = r.commands();
+            child = commands.create();
+            commands.emplace<Health>(child, 2);
+            commands.destroy(e);
+        });
+    registry.onDestroy<Health>().connect(
+        [&](Registry& r, Registry::Entity) {
+            r.commands().emplace<Position>(marker);
+        });
+
+    auto& commands = registry.commands();
+    auto spawned = commands.create();
+    commands.emplace<Health>(spawned, 1);
+    registry.flushCommands();
+
+    EXPECT_FALSE(registry.valid(spawned));
+    ASSERT_TRUE(registry.has<Health>(child));
+    EXPECT_EQ(registry.get<Health>(child).hp, 2);
+    EXPECT_TRUE(registry.has<Position>(marker));
+    EXPECT_TRUE(commands.empty());
+}
+
+TEST(RegistrySignalTest, ArchetypeStoragePublishesToo) {
+    Registry registry(StorageMode::Archetype);
+    int constructed = 0;
+    int updated = 0;
+    int destroyed = 0;
+    registry.onConstruct<Position>().connect(
+        [&](Registry&, Registry::Entity) { constructed++; });
+    registry.onUpdate<Position>().connect(
+        [&](Registry&, Registry::Entity) { updated++; });
+    registry.onDestroy<Position>().connect(
+        [&](Registry&, Registry::Entity) { destroyed++; });
+
+    auto e = registry.create();
+    registry.emplace<Position>(e);
+    registry.patch<Position>(e, [](Position& pos) { pos.x = 1.0f; });
+    registry.destroy(e);
+
+    EXPECT_EQ(constructed, 1);
+    EXPECT_EQ(updated, 1);
+    EXPECT_EQ(destroyed, 1);
+}
+
+class ReactiveSystem : public System<ReactiveSystem> {
+public:
+    ReactiveSystem() { requireComponents<Health>(); }
+    void onAttach(Registry& registry) override {
+        connection = registry.onUpdate<Health>().connect(
+            [this](Registry&, Registry::Entity e) { queued.push_back(e); });
+    }
+    void onDetach(Registry& registry) override {
+        registry.onUpdate<Health>().disconnect(connection);
+    }
+    void onUpdate(Registry&, float) {
+        handled += queued.size();
+        queued.clear();
+    }
+    std::vector<Registry::Entity> queued;
+    size_t handled = 0;
+    Registry::ComponentSignal::Connection connection = 0;
+};
+
+TEST(RegistrySignalTest, SystemsConnectWhenAddedAndDisconnectWhenRemoved) {
+    Registry registry;
+    auto& system = registry.addSystem<ReactiveSystem>();
+    auto e = registry.create();
+    registry.emplace<Health>(e);
+
+    registry.patch<Health>(e, [](Health& health) { health.hp--; });
+    registry.update(registry.getClock().getFixedDeltaTime());
+    EXPECT_EQ(system.handled, 1u);
+
+    registry.removeSystem<ReactiveSystem>();
+    EXPECT_TRUE(registry.onUpdate<Health>().empty());
+}
+
+struct Chunked {
+    int value;
+    Chunked(int v = 0) : value(v) {}
+};
+
+template <>
+struct ComponentStorage<Chunked> {
+    static constexpr StorageMode mode = StorageMode::Archetype;
+};
+
+TEST(RegistryArchetypeTest, EmplaceGetRemoveDestroy) {
+    Registry registry(StorageMode::Archetype);
+    auto e = registry.create();
+
+    registry.emplace<Position>(e, 1.0f, 2.0f, 3.0f);
+    registry.emplace<Velocity>(e, 4.0f);
+
+    EXPECT_TRUE(registry.has<Position>(e));
+    EXPECT_FLOAT_EQ(registry.get<Position>(e).y, 2.0f);
+    EXPECT_FLOAT_EQ(registry.get<Velocity>(e).vx, 4.0f);
+    EXPECT_EQ(registry.count<Position>(), 1);
+
+    registry.remove<Velocity>(e);
+    EXPECT_FALSE(registry.has<Velocity>(e));
+    EXPECT_FLOAT_EQ(registry.get<Position>(e).z, 3.0f);
+    EXPECT_FALSE(registry.getAvailableComponents().test(
+        ComponentRegistry::typeID<Velocity>()));
+
+    registry.destroy(e);
+    EXPECT_EQ(registry.count<Position>(), 0);
+    EXPECT_EQ(registry.alive(), 0);
+}
+
+TEST(RegistryArchetypeTest, EachMatchesSparseSetMode) {
+    Registry sparse;
+    Registry chunked(StorageMode::Archetype);
+
+    for (Registry* registry : {&sparse, &chunked}) {
+        for (int i = 0; i < 100; ++i) {
+            auto e = registry->create();
+            registry->emplace<Position>(e, float(i));
+            if (i % 2 == 0)
+                registry->emplace<Velocity>(e, 1.0f);
+            if (i % 3 == 0)
+                registry->emplace<Health>(e, i);
+        }
+    }
+
+    auto sum = [](Registry& registry) {
+        float total = 0;
+        registry.each<Position, Velocity>(
+            [&](auto, Position& p, Velocity& v) { total += p.x * v.vx; });
+        return total;
+    };
+    EXPECT_FLOAT_EQ(sum(chunked), sum(sparse));
+
+    int visited = 0;
+    chunked.each<Position, Velocity, Health>(
+        [&](auto, Position&, Velocity&, Health&) { visited++; });
+    EXPECT_EQ(visited, 17);
+}
+
+TEST(RegistryArchetypeTest, PerComponentStorageTrait) {
+    Registry registry;
+    for (int i = 0; i < 10; ++i) {
+        auto e = registry.create();
+        registry.emplace<Chunked>(e, i);
+        if (i < 4)
+            registry.emplace<Health>(e, i);
+    }
+
+    // Health stays in a SparseSet pool; Chunked lives in archetypes
+    EXPECT_EQ(registry.view<Health>().size(), 4);
+    EXPECT_THROW(registry.view<Chunked>(), std::logic_error);
+
+    int total = 0;
+    registry.each<Chunked, Health>([&](auto, Chunked& c, Health& h) {
+        EXPECT_EQ(c.value, h.hp);
+        total++;
+    });
+    EXPECT_EQ(total, 4);
+    EXPECT_EQ(registry.count<Chunked>(), 10);
+}
+
+TEST(RegistryArchetypeTest, DestroyDuringEach) {
+    Registry registry(StorageMode::Archetype);
+    for (int i = 0; i < 10; ++i) {
+        registry.emplace<Health>(registry.create(), i);
+    }
+
+    int visited = 0;
+    registry.each<Health>([&](auto e, Health&) {
+        visited++;
+        registry.destroy(e);
+    });
+
+    EXPECT_EQ(visited, 10);
+    EXPECT_EQ(registry.count<Health>(), 0);
+}
+
+TEST(RegistryArchetypeTest, GroupForwardsToEach) {
+    Registry registry(StorageMode::Archetype);
+    for (int i = 0; i < 20; ++i) {
+        auto e = registry.create();
+        registry.emplace<Position>(e);
+        if (i % 4 == 0)
+            registry.emplace<Velocity>(e, 2.0f);
+    }
+
+    auto& group = registry.group<Velocity>(observe<Position>);
+    EXPECT_EQ(group.size(), 5);
+
+    group.each([](auto, Velocity& v, Position& p) { p.x += v.vx; });
+
+    float total = 0;
+    registry.each<Position>([&](auto, Position& p) { total += p.x; });
+    EXPECT_FLOAT_EQ(total, 10.0f);
+
+    auto e = registry.create();
+    registry.emplace<Velocity>(e);
+    registry.emplace<Position>(e);
+    EXPECT_TRUE(group.contains(e));
+    EXPECT_EQ(group.size(), 6);
+}
+
+TEST(RegistryArchetypeTest, ClearResetsStorage) {
+    Registry registry(StorageMode::Archetype);
+    registry.emplace<Position>(registry.create());
+    registry.clear();
+
+    EXPECT_EQ(registry.count<Position>(), 0);
+
+    auto e = registry.create();
+    registry.emplace<Position>(e, 7.0f);
+    EXPECT_FLOAT_EQ(registry.get<Position>(e).x, 7.0f);
+}
+
 TEST(RegistryPerformance, CreateDestroyManyEntities) {
     Registry registry;
     const size_t COUNT = 100000;
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include "../ecs/Registry.hpp"
+#include <stdexcept>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Tally {
+    int value = 0;
+};
+
+struct Level {
+    std::string name;
+    explicit Level(std::string name) : name(std::move(name)) {}
+};
+
+struct Walker {
+    int steps = 0;
+};
+
+class TallySystem : public System<TallySystem> {
+public:
+    TallySystem() {
+        requireComponents<Walker>();
+        writeResources<Tally>();
+    }
+    void onUpdate(Registry& registry, float) {
+        int& tally = registry.resources().get<Tally>().value;
+        registry.each<Walker>([&](auto, Walker& walker) {
+            walker.steps++;
+            tally++;
+        });
+    }
+};
+
+class TallyReader : public System<TallyReader> {
+public:
+    TallyReader() {
+        requireComponents<Walker>();
+        readResources<Tally>();
+    }
+    void onUpdate(Registry&, float) {}
+};
+
+// ============================================================================
+// STORAGE
+// ============================================================================
+
+TEST(ResourcesTest, EmplaceGetFindErase) {
+    Resources resources;
+    EXPECT_FALSE(resources.contains<Tally>());
+    EXPECT_EQ(resources.find<Tally>(), nullptr);
+    EXPECT_THROW(resources.get<Tally>(), std::out_of_range);
+
+    resources.emplace<Tally>().value = 3;
+    resources.emplace<Level>("intro");
+    EXPECT_EQ(resources.get<Tally>().value, 3);
+    EXPECT_EQ(resources.get<Level>().name, "intro");
+
+    resources.erase<Tally>();
+    EXPECT_FALSE(resources.contains<Tally>());
+    EXPECT_TRUE(resources.contains<Level>());
+}
+
+TEST(ResourcesTest, EmplaceReplacesThePreviousValue) {
+    Resources resources;
+    resources.emplace<Level>("intro");
+    resources.emplace<Level>("boss");
+
+    EXPECT_EQ(resources.get<Level>().name, "boss");
+}
+
+TEST(ResourcesTest, GetOrEmplaceKeepsTheExistingValue) {
+    Resources resources;
+    resources.getOrEmplace<Tally>().value = 4;
+
+    EXPECT_EQ(resources.getOrEmplace<Tally>().value, 4);
+}
+
+TEST(ResourcesTest, EachRegistryHasItsOwn) {
+    Registry first;
+    Registry second;
+    first.resources().emplace<Tally>().value = 1;
+
+    EXPECT_FALSE(second.resources().contains<Tally>());
+
+    first.clear();
+    EXPECT_EQ(first.resources().get<Tally>().value, 1);
+}
+
+TEST(ResourcesTest, ResourceWritersConflictWithReaders) {
+    TallySystem writer;
+    TallyReader reader;
+
+    EXPECT_TRUE(writer.getAccess().conflictsWith(reader.getAccess()));
+    EXPECT_FALSE(reader.getAccess().conflictsWith(reader.getAccess()));
+}
+
+TEST(ResourcesTest, ResourcesAreIndexedApartFromComponents) {
+    // Same type stored as a component: its writers do not touch the resource
+    class TallyComponentWriter : public System<TallyComponentWriter> {
+    public:
+        TallyComponentWriter() { writeComponents<Tally>(); }
+        void onUpdate(Registry&, float) {}
+    };
+    TallyComponentWriter componentWriter;
+    TallyReader reader;
+
+    EXPECT_FALSE(componentWriter.getAccess().conflictsWith(reader.getAccess()));
+    EXPECT_NE(Resources::typeID<Tally>(), Resources::typeID<Level>());
+}
+
+// ============================================================================
+// CONCURRENT WORLDS
+// ============================================================================
+
+TEST(ResourcesTest, WorldsUpdateConcurrently) {
+    constexpr int WORLDS = 8;
+    constexpr int WALKERS = 100;
+    constexpr int STEPS = 50;
+    std::vector<std::unique_ptr<Registry>> worlds;
+    for (int w = 0; w < WORLDS; ++w) {
+        worlds.push_back(std::make_unique<Registry>());
+        Registry& world = *worlds.back();
+        world.resources().emplace<Tally>();
+        world.addSystem<TallySystem>();
+        for (int i = 0; i < WALKERS + w; ++i) {
+            world.emplace<Walker>(world.create());
+        }
+    }
+
+    std::vector<std::thread> threads;
+    for (auto& world : worlds) {
+        threads.emplace_back([&world] {
+            for (int step = 0; step < STEPS; ++step) {
+                world->update(world->getClock().getFixedDeltaTime());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int w = 0; w < WORLDS; ++w) {
+        EXPECT_EQ(
+            worlds[w]->resources().get<Tally>().value,
+            (WALKERS + w) * STEPS);
+    }
+}
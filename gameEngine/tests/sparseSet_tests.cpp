@@ -4,6 +4,7 @@
 #include <chrono>
 #include <algorithm>
 #include <random>
+#include <memory_resource>
 
 // ============================================================================
 // TEST STRUCTURES
@@ -154,6 +155,18 @@ TEST(SparseSetTest, EmplaceDoesNotDuplicateIfAlreadyPresent) {
     EXPECT_EQ(set.get(0).x, 1.0f);
 }
 
+TEST(SparseSetTest, EmplaceRejectsAnotherGeneration) {
+    SparseSet<Entity, Position> set;
+    const Entity current = (1u << ENTITY_INDEX_BITS) | 5u;
+    const Entity stale = 5u;
+    set.emplace(current, 1.0f, 2.0f, 3.0f);
+
+    EXPECT_THROW(set.emplace(stale, 9.0f, 9.0f, 9.0f), std::logic_error);
+    EXPECT_FALSE(set.contains(stale));
+    EXPECT_EQ(set.get(current).x, 1.0f);
+    EXPECT_EQ(set.size(), 1);
+}
+
 TEST(SparseSetTest, EmplaceWithHighEntityId) {
     SparseSet<Entity, Position> set;
     set.emplace(1000, 1.0f, 2.0f, 3.0f);
@@ -555,6 +568,57 @@ TEST(SparseSetTest, ComponentsAreContiguous) {
     EXPECT_EQ(ptr2 - ptr1, 1);
 }
 
+// ============================================================================
+// PAGED SPARSE INDEX TESTS
+// ============================================================================
+
+TEST(SparseSetTest, PagesAllocatedOnDemand) {
+    SparseSet<Entity, Position> set;
+    EXPECT_EQ(set.pageCount(), 0);
+
+    set.emplace(0, 0.0f, 0.0f, 0.0f);
+    set.emplace(1, 1.0f, 1.0f, 1.0f);
+    EXPECT_EQ(set.pageCount(), 1);
+
+    Entity farId = 10 * SparseSet<Entity, Position>::PAGE_SIZE;
+    set.emplace(farId, 2.0f, 2.0f, 2.0f);
+    EXPECT_EQ(set.pageCount(), 2);
+    EXPECT_FALSE(set.contains(farId - 1));
+    EXPECT_EQ(set.get(farId).x, 2.0f);
+}
+
+TEST(SparseSetTest, EmptyPagesAreReleased) {
+    SparseSet<Entity, Position> set;
+    const Entity pageSize = SparseSet<Entity, Position>::PAGE_SIZE;
+
+    set.emplace(3, 3.0f, 3.0f, 3.0f);
+    set.emplace(pageSize + 3, 4.0f, 4.0f, 4.0f);
+    EXPECT_EQ(set.pageCount(), 2);
+
+    set.erase(3);
+    EXPECT_EQ(set.pageCount(), 1);
+    EXPECT_FALSE(set.contains(3));
+    EXPECT_TRUE(set.contains(pageSize + 3));
+    EXPECT_EQ(set.get(pageSize + 3).x, 4.0f);
+
+    set.emplace(3, 5.0f, 5.0f, 5.0f);
+    EXPECT_EQ(set.pageCount(), 2);
+    EXPECT_EQ(set.get(3).x, 5.0f);
+}
+
+TEST(SparseSetTest, SparseMemoryFollowsPopulatedPages) {
+    SparseSet<Entity, Position> dense;
+    SparseSet<Entity, Position> sparse;
+
+    for (Entity e = 0; e < 100000; ++e) {
+        dense.emplace(e);
+    }
+    sparse.emplace(99999);
+
+    EXPECT_EQ(sparse.pageCount(), 1);
+    EXPECT_LT(sparse.memoryUsage(), dense.memoryUsage() / 100);
+}
+
 // ============================================================================
 // DATA COHERENCES TESTS
 // ============================================================================
@@ -605,4 +669,78 @@ TEST(SparseSetTest, AllEntitiesAccessibleAfterErase) {
             EXPECT_EQ(set.get(i).x, i * 1.0f);
         }
     }
-}
\ No newline at end of file
+}
+
+TEST(SparseSetTest, TakesAllItsMemoryFromTheAllocator) {
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::polymorphic_allocator<Position> allocator(&arena);
+    SparseSet<Entity, Position, std::pmr::polymorphic_allocator<Position>> set(allocator);
+
+    for (Entity e = 0; e < 100; ++e) {
+        set.emplace(e, e * 1.0f);
+    }
+    set.emplace(3 * SparseSet<Entity, Position>::PAGE_SIZE, 7.0f);
+    set.erase(3 * SparseSet<Entity, Position>::PAGE_SIZE);
+
+    EXPECT_EQ(set.get_allocator().resource(), &arena);
+    EXPECT_EQ(set.components().get_allocator().resource(), &arena);
+    EXPECT_EQ(set.size(), 100u);
+    EXPECT_EQ(set.get(42).x, 42.0f);
+}
+
+TEST(SparseSetTest, ChangeTicksFollowTheDenseArray) {
+    SparseSet<Entity, Position> set;
+    set.emplace(1);
+    set.emplace(2);
+    set.emplace(3);
+    EXPECT_EQ(set.changedAt(1), 0u);
+
+    set.enableChangeTracking(5);
+    set.touch(3, 7);
+    set.emplace(4);
+    set.touch(4, 8);
+    set.erase(1);
+    set.swapAt(0, 1);
+
+    EXPECT_EQ(set.changedAt(2), 5u);
+    EXPECT_EQ(set.changedAt(3), 7u);
+    EXPECT_EQ(set.changedAt(4), 8u);
+    EXPECT_EQ(set.changeTicks().size(), set.size());
+}
+
+// ============================================================================
+// TAG COMPONENTS
+// ============================================================================
+
+struct Marker {};
+
+TEST(SparseSetTest, TagsOnlyStoreMembership) {
+    SparseSet<Entity, Marker> tags;
+    SparseSet<Entity, Position> positions;
+    for (Entity e = 0; e < 1000; ++e) {
+        tags.emplace(e);
+        positions.emplace(e);
+    }
+
+    EXPECT_TRUE(tags.components().empty());
+    EXPECT_EQ(tags.size(), 1000u);
+    EXPECT_LT(tags.memoryUsage(), positions.memoryUsage());
+    EXPECT_EQ(&tags.element(3), &tags.element(999));
+}
+
+TEST(SparseSetTest, TagMembershipSurvivesEraseAndSwap) {
+    SparseSet<Entity, Marker> tags;
+    for (Entity e = 0; e < 5; ++e) {
+        tags.emplace(e);
+    }
+    tags.erase(1);
+    tags.swapAt(0, 2);
+    tags.erase(1);
+
+    EXPECT_FALSE(tags.contains(1));
+    EXPECT_EQ(tags.size(), 4u);
+    for (Entity e : {0u, 2u, 3u, 4u}) {
+        ASSERT_TRUE(tags.contains(e));
+        EXPECT_EQ(tags.begin()[tags.index(e)], e);
+    }
+}
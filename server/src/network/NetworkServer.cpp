@@ -101,15 +101,24 @@ void rtype::NetworkServer::initECS()
     }
 
     _registry->addSystem<GameEngine::Collision>(2);
-    _registry->addSystem<GameEngine::ApplyScore>(3);
-    GameEngine::Death& deathSystem = _registry->addSystem<GameEngine::Death>(4);
-    _registry->addSystem<GameEngine::DomainHandler>(5);
-    _registry->addSystem<GameEngine::SinusoidalAI>(6);
-    _registry->addSystem<GameEngine::Animation>(7);
-
-    deathSystem.onPlayerDeath = [this](EntityManager::Entity e) {
+    _registry->addSystem<GameEngine::ApplyDamage>(3);
+    _registry->addSystem<GameEngine::Pickup>(4);
+    _registry->addSystem<GameEngine::ApplyScore>(5);
+    GameEngine::Death& deathSystem = _registry->addSystem<GameEngine::Death>(6);
+    _registry->addSystem<GameEngine::DomainHandler>(7);
+    _registry->addSystem<GameEngine::SinusoidalAI>(8);
+    _registry->addSystem<GameEngine::Animation>(9);
+
+    // Keeps the Collision inputs in screen order, so neighbouring grid cells
+    // are read from neighbouring memory
+    _registry->sortIncrementally<
+        GameEngine::Position, GameEngine::Damage, GameEngine::Collider,
+        GameEngine::Health>(
+        GameEngine::SpatialOrder{}, std::chrono::microseconds(200));
+
+    deathSystem.onPlayerDeath.connect([this](EntityManager::Entity e) {
         this->handlePlayerDeath(e);
-    };
+    });
 }
 
 /**
@@ -416,9 +425,12 @@ std::vector<uint8_t> rtype::NetworkServer::serializeSnapshot()
     auto tsBytes = toBytes<uint32_t>(timestamp);
     snapshot.insert(snapshot.end(), tsBytes.begin(), tsBytes.end());
 
-    auto scoreBytes = toBytes<int>(_registry->score);
+    const auto* score = _registry->resources().find<GameEngine::Score>();
+    auto scoreBytes = toBytes<int>(score ? score->points : 0);
     snapshot.insert(snapshot.end(), scoreBytes.begin(), scoreBytes.end());
 
+    const auto& assets =
+        _registry->resources().getOrEmplace<GameEngine::AssetRegistry>();
     _registry->each<GameEngine::Renderable, GameEngine::Position>(
         [&](EntityManager::Entity entity, GameEngine::Renderable& render,
             GameEngine::Position& pos) {
@@ -429,21 +441,24 @@ std::vector<uint8_t> rtype::NetworkServer::serializeSnapshot()
             auto yBytes = floatToBytes(pos.pos.y);
             snapshot.insert(snapshot.end(), yBytes.begin(), yBytes.end());
 
-            uint8_t pathLen =
-                static_cast<uint8_t>(render.spriteSheetPath.size());
+            const std::string& path = assets.sheetPath(render.sheet);
+            uint8_t pathLen = static_cast<uint8_t>(path.size());
             snapshot.push_back(pathLen);
-            snapshot.insert(
-                snapshot.end(), render.spriteSheetPath.begin(),
-                render.spriteSheetPath.end());
-
-            auto rectPosX = floatToBytes(render.currentRectPos.x);
+            snapshot.insert(snapshot.end(), path.begin(), path.end());
+
+            const GameEngine::SpriteAnimation& animation =
+                assets.animation(render.animation);
+            vec2 rect = animation.frames.empty()
+                            ? vec2()
+                            : animation.frames[render.frame];
+            auto rectPosX = floatToBytes(rect.x);
             snapshot.insert(snapshot.end(), rectPosX.begin(), rectPosX.end());
-            auto rectPosY = floatToBytes(render.currentRectPos.y);
+            auto rectPosY = floatToBytes(rect.y);
             snapshot.insert(snapshot.end(), rectPosY.begin(), rectPosY.end());
 
-            auto rectSizeX = floatToBytes(render.rectSize.x);
+            auto rectSizeX = floatToBytes(animation.frameSize.x);
             snapshot.insert(snapshot.end(), rectSizeX.begin(), rectSizeX.end());
-            auto rectSizeY = floatToBytes(render.rectSize.y);
+            auto rectSizeY = floatToBytes(animation.frameSize.y);
             snapshot.insert(snapshot.end(), rectSizeY.begin(), rectSizeY.end());
         });
 
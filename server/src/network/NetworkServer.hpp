@@ -6,11 +6,13 @@
 */
 
 #pragma once
+#include <array>
 #include <asio.hpp>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "../../../gameEngine/components/AIControlled/src/AIControlled.hpp"
@@ -25,6 +27,7 @@
 #include "../../../gameEngine/systems/FPInputHandler/src/FPInputHandler.hpp"
 #include "../../../gameEngine/systems/FPMotion/src/FPMotion.hpp"
 #include "../../../gameEngine/systems/animation/src/Animation.hpp"
+#include "../../../gameEngine/systems/applyDamage/src/ApplyDamage.hpp"
 #include "../../../gameEngine/systems/applyScore/src/ApplyScore.hpp"
 #include "../../../gameEngine/systems/collision/src/Collision.hpp"
 #include "../../../gameEngine/systems/death/src/Death.hpp"
@@ -32,6 +35,7 @@
 #include "../../../gameEngine/systems/enemyShoot/src/EnemyShoot.hpp"
 #include "../../../gameEngine/systems/inputHandler/src/InputHandler.hpp"
 #include "../../../gameEngine/systems/motion/src/Motion.hpp"
+#include "../../../gameEngine/systems/pickup/src/Pickup.hpp"
 #include "../../../gameEngine/systems/sinusoidalAI/src/SinusoidalAI.hpp"
 
 namespace rtype {
@@ -202,6 +206,9 @@ class NetworkServer
     std::mutex _registryMutex;
 
     std::vector<EnemySpawnData> _enemySpawnList;
+    std::map<std::pair<std::string, std::array<float, 4>>, Prefab>
+        _enemyPrefabs;  ///< Level enemies, by sprite and texture rect
+    Prefab _randomEnemy;  ///< Enemy spawned by createEnemyEntity()
     float _gameTime = 0.0f;
     size_t _nextEnemyToSpawn = 0;
 
@@ -227,53 +227,63 @@ void rtype::NetworkServer::checkAndSpawnEnemies()
 EntityManager::Entity rtype::NetworkServer::createEnemyFromData(
     const EnemySpawnData& data)
 {
-    std::lock_guard<std::mutex> lock(_registryMutex);
-    Registry::Entity entity = _registry->create();
-
-    float velocity = 200.0f;
-    float acceleration = -1200.0f;
-    int health = 1;
-    int damage = 1;
-    int animSpeed = 1000;
-
-    _registry->emplace<GameEngine::AIControlled>(entity);
-    _registry->emplace<GameEngine::Acceleration>(entity, acceleration, 0.0f);
-    _registry->emplace<GameEngine::Position>(entity, data.x, data.y);
-    _registry->emplace<GameEngine::Velocity>(entity, velocity);
-
-    std::vector<vec2> rectPos;
-    int frameCount = 8;
-    float frameWidth = data.textureRect[2];
-
-    for (int i = 0; i < frameCount; i++) {
-        rectPos.push_back(
-            vec2{data.textureRect[0] + i * frameWidth, data.textureRect[1]});
-    }
-
-    _registry->emplace<GameEngine::Renderable>(
-        entity, 1920.0f, 1080.0f, data.spritePath, rectPos,
-        vec2{data.textureRect[2], data.textureRect[3]}, animSpeed, true);
-
-    _registry->emplace<GameEngine::Collider>(
-        entity, vec2(0.0, 0.0), std::bitset<8>("10100000"),
-        std::bitset<8>("01000000"),
-        vec2(data.textureRect[2], data.textureRect[3]));
-
-    _registry->emplace<GameEngine::Domain>(entity, 5.0f, 0.0f, 1920.0f, 1080.0);
-
-    _registry->emplace<GameEngine::Health>(entity, health, health);
-    _registry->emplace<GameEngine::Damage>(entity, damage);
-
     std::random_device rd;
     std::mt19937 gen(rd());
 
     std::uniform_real_distribution<float> phaseDist(0.0f, 6.28318f);
     float phaseOffset = phaseDist(gen);
 
-    _registry->emplace<GameEngine::SinusoidalPattern>(
-        entity, 150.0f, 0.003f, phaseOffset);
+    std::lock_guard<std::mutex> lock(_registryMutex);
+    auto prefab = _enemyPrefabs.find({data.spritePath, data.textureRect});
+    if (prefab == _enemyPrefabs.end()) {
+        float velocity = 200.0f;
+        float acceleration = -1200.0f;
+        int health = 1;
+        int damage = 1;
+        int animSpeed = 1000;
+
+        std::vector<vec2> rectPos;
+        int frameCount = 8;
+        float frameWidth = data.textureRect[2];
+
+        for (int i = 0; i < frameCount; i++) {
+            rectPos.push_back(vec2{
+                data.textureRect[0] + i * frameWidth, data.textureRect[1]});
+        }
+
+        auto& assets =
+            _registry->resources().getOrEmplace<GameEngine::AssetRegistry>();
+        Prefab enemy;
+        enemy.with<GameEngine::AIControlled>()
+            .with<GameEngine::Acceleration>(acceleration, 0.0f)
+            .with<GameEngine::Velocity>(velocity)
+            .with<GameEngine::Renderable>(
+                assets.sheet(data.spritePath),
+                assets.animation(
+                    std::move(rectPos),
+                    vec2{data.textureRect[2], data.textureRect[3]}, animSpeed,
+                    true))
+            .with<GameEngine::Collider>(
+                vec2(0.0, 0.0), std::bitset<8>("10100000"),
+                std::bitset<8>("01000000"),
+                vec2(data.textureRect[2], data.textureRect[3]))
+            .with<GameEngine::Domain>(5.0f, 0.0f, 1920.0f, 1080.0)
+            .with<GameEngine::Health>(health, health)
+            .with<GameEngine::Damage>(damage)
+            .with<GameEngine::ScoreValue>(1);
+        prefab = _enemyPrefabs
+                     .emplace(
+                         std::make_pair(data.spritePath, data.textureRect),
+                         std::move(enemy))
+                     .first;
+    }
 
-    _registry->emplace<GameEngine::ScoreValue>(entity, 1);
+    Registry::Entity entity =
+        _registry->spawn(prefab->second, [&](Registry::Entity e) {
+            _registry->emplace<GameEngine::Position>(e, data.x, data.y);
+            _registry->emplace<GameEngine::SinusoidalPattern>(
+                e, 150.0f, 0.003f, phaseOffset);
+        });
 
     std::cout << "[SERVER] Spawned enemy type " << data.type << " at ("
               << data.x << ", " << data.y << ")" << " | time=" << data.spawnTime
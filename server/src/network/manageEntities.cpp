@@ -28,6 +28,8 @@ EntityManager::Entity rtype::NetworkServer::createPlayerEntity(uint8_t playerId)
 {
     std::lock_guard<std::mutex> lock(_registryMutex);
     auto entity = _registry->create();
+    auto& assets =
+        _registry->resources().getOrEmplace<GameEngine::AssetRegistry>();
 
     if (this->_game == std::string("flappyByte")) {
         std::vector<vec2> rectPos;
@@ -45,8 +47,9 @@ EntityManager::Entity rtype::NetworkServer::createPlayerEntity(uint8_t playerId)
             entity, 100.0f, 100.0f + playerId * 50.0f);
         _registry->emplace<GameEngine::Velocity>(entity, 500.0f);
         _registry->emplace<GameEngine::Renderable>(
-            entity, 1920.0f, 1080.0f, "assets/sprites/birds.png", rectPos,
-            vec2{16.0f, 16.0f}, 500, false);
+            entity, assets.sheet("assets/sprites/birds.png"),
+            assets.animation(
+                std::move(rectPos), vec2{16.0f, 16.0f}, 500, false));
         _registry->emplace<GameEngine::Collider>(
             entity, vec2(0.0, 0.0), std::bitset<8>("01000000"),
             std::bitset<8>("10000000"), vec2(32.0, 32.0));
@@ -78,8 +81,9 @@ EntityManager::Entity rtype::NetworkServer::createPlayerEntity(uint8_t playerId)
             entity, 100.0f, 100.0f + playerId * 50.0f);
         _registry->emplace<GameEngine::Velocity>(entity, 500.0f);
         _registry->emplace<GameEngine::Renderable>(
-            entity, 1920.0f, 1080.0f, "assets/sprites/r-typesheet42.png",
-            rectPos, vec2{33.2f, 17.2f}, 500, false);
+            entity, assets.sheet("assets/sprites/r-typesheet42.png"),
+            assets.animation(
+                std::move(rectPos), vec2{33.2f, 17.2f}, 500, false));
         _registry->emplace<GameEngine::Collider>(
             entity, vec2(0.0, 0.0), std::bitset<8>("01000000"),
             std::bitset<8>("10010000"), vec2(66.4, 34.4));
@@ -128,9 +132,12 @@ EntityManager::Entity rtype::NetworkServer::createEnemyEntity()
                 _registry->emplace<GameEngine::ScoreValue>(entity, 1);
             } else
                 rectPos.push_back(vec2{32.0F * float(pipe), 23.0F});
+            auto& assets = _registry->resources()
+                               .getOrEmplace<GameEngine::AssetRegistry>();
             _registry->emplace<GameEngine::Renderable>(
-                entity, 1920.0f, 1080.0f, "assets/sprites/coloredpipes.png",
-                rectPos, vec2{32.0f, 34.0f}, 500, true);
+                entity, assets.sheet("assets/sprites/coloredpipes.png"),
+                assets.animation(
+                    std::move(rectPos), vec2{32.0f, 34.0f}, 500, true));
             _registry->emplace<GameEngine::Collider>(
                 entity, vec2(0.0, 0.0), std::bitset<8>("10000000"),
                 std::bitset<8>("01000000"), vec2(64.0, 68.0));
@@ -154,9 +161,12 @@ EntityManager::Entity rtype::NetworkServer::createEnemyEntity()
                 rectPos.push_back(vec2{32.0F * float(pipe), 0.0F});
             else
                 rectPos.push_back(vec2{32.0F * float(pipe), 23.0F});
+            auto& assets = _registry->resources()
+                               .getOrEmplace<GameEngine::AssetRegistry>();
             _registry->emplace<GameEngine::Renderable>(
-                entity, 1920.0f, 1080.0f, "assets/sprites/coloredpipes.png",
-                rectPos, vec2{32.0f, 34.0f}, 500, true);
+                entity, assets.sheet("assets/sprites/coloredpipes.png"),
+                assets.animation(
+                    std::move(rectPos), vec2{32.0f, 34.0f}, 500, true));
             _registry->emplace<GameEngine::Collider>(
                 entity, vec2(0.0, 0.0), std::bitset<8>("10000000"),
                 std::bitset<8>("01000000"), vec2(64.0, 68.0));
@@ -169,39 +179,38 @@ EntityManager::Entity rtype::NetworkServer::createEnemyEntity()
         std::uniform_int_distribution<> distrib(0, 976);
         int randomNum = distrib(gen);
 
-        std::lock_guard<std::mutex> lock(_registryMutex);
-        auto entity = _registry->create();
-        _registry->emplace<GameEngine::AIControlled>(entity);
-        _registry->emplace<GameEngine::Acceleration>(
-            entity, -400.0f, 0.0f, false);
-        _registry->emplace<GameEngine::Position>(entity, 1900, randomNum);
-        _registry->emplace<GameEngine::Velocity>(entity, 400.0f);
-        std::vector<vec2> rectPos;
-        rectPos.push_back(vec2{0.0f, 0.0f});
-        rectPos.push_back(vec2{33.3f, 0.0f});
-        rectPos.push_back(vec2{66.6f, 0.0f});
-        rectPos.push_back(vec2{99.9f, 0.0f});
-        rectPos.push_back(vec2{133.2f, 0.0f});
-        rectPos.push_back(vec2{166.5f, 0.0f});
-        rectPos.push_back(vec2{199.8f, 0.0f});
-        rectPos.push_back(vec2{233.1f, 0.0f});
-        _registry->emplace<GameEngine::Renderable>(
-            entity, 1920.0f, 1080.0f, "assets/sprites/r-typesheet5.png",
-            rectPos, vec2{33.3f, 36.0f}, 1000, true);
-        _registry->emplace<GameEngine::Collider>(
-            entity, vec2(0.0, 0.0), std::bitset<8>("10100000"),
-            std::bitset<8>("01000000"), vec2(66.6, 72.0));
-        _registry->emplace<GameEngine::Domain>(
-            entity, 5.0f, 0.0f, 1920.0f, 1080.0);
-        _registry->emplace<GameEngine::Health>(entity, 1, 1);
-        _registry->emplace<GameEngine::Damage>(entity, 1);
         std::uniform_real_distribution<float> phaseDist(0.0f, 6.28318f);
         float phaseOffset = phaseDist(gen);
 
-        _registry->emplace<GameEngine::SinusoidalPattern>(
-            entity, 150.0f, 0.003f, phaseOffset);
-        _registry->emplace<GameEngine::ScoreValue>(entity, 1);
-        _registry->emplace<GameEngine::FireRate>(entity, 1);
+        std::lock_guard<std::mutex> lock(_registryMutex);
+        if (_randomEnemy.size() == 0) {
+            auto& assets = _registry->resources()
+                               .getOrEmplace<GameEngine::AssetRegistry>();
+            _randomEnemy.with<GameEngine::AIControlled>()
+                .with<GameEngine::Acceleration>(-400.0f, 0.0f, false)
+                .with<GameEngine::Velocity>(400.0f)
+                .with<GameEngine::Renderable>(
+                    assets.sheet("assets/sprites/r-typesheet5.png"),
+                    assets.animation(
+                        {vec2{0.0f, 0.0f}, vec2{33.3f, 0.0f},
+                         vec2{66.6f, 0.0f}, vec2{99.9f, 0.0f},
+                         vec2{133.2f, 0.0f}, vec2{166.5f, 0.0f},
+                         vec2{199.8f, 0.0f}, vec2{233.1f, 0.0f}},
+                        vec2{33.3f, 36.0f}, 1000, true))
+                .with<GameEngine::Collider>(
+                    vec2(0.0, 0.0), std::bitset<8>("10100000"),
+                    std::bitset<8>("01000000"), vec2(66.6, 72.0))
+                .with<GameEngine::Domain>(5.0f, 0.0f, 1920.0f, 1080.0)
+                .with<GameEngine::Health>(1, 1)
+                .with<GameEngine::Damage>(1)
+                .with<GameEngine::ScoreValue>(1)
+                .with<GameEngine::FireRate>(1);
+        }
+        _registry->spawn(_randomEnemy, [&](EntityManager::Entity entity) {
+            _registry->emplace<GameEngine::Position>(entity, 1900, randomNum);
+            _registry->emplace<GameEngine::SinusoidalPattern>(
+                entity, 150.0f, 0.003f, phaseOffset);
+        });
     }
 
     return 1;